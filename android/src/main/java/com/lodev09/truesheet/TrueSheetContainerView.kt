@@ -3,10 +3,13 @@ package com.lodev09.truesheet
 import android.annotation.SuppressLint
 import android.view.View
 import android.view.ViewGroup
+import com.facebook.react.uimanager.PixelUtil.dpToPx
 import com.facebook.react.uimanager.ThemedReactContext
 import com.facebook.react.uimanager.events.EventDispatcher
 import com.facebook.react.util.RNLog
 import com.facebook.react.views.view.ReactViewGroup
+import com.lodev09.truesheet.core.TrueSheetLayoutRegistry
+import kotlin.math.roundToInt
 
 interface TrueSheetContainerViewDelegate {
   val eventDispatcher: EventDispatcher?
@@ -177,6 +180,21 @@ class TrueSheetContainerView(reactContext: ThemedReactContext) :
     peekViewDidChangeSize(0, 0)
   }
 
+  /**
+   * Refreshes heights from the layout committed by the shadow nodes. Presenting right after
+   * mount would otherwise use stale heights until the views receive `onSizeChanged`.
+   */
+  fun syncMeasuredHeights() {
+    contentView?.let { contentHeight = measuredHeight(it, contentHeight) }
+    headerView?.let { headerHeight = measuredHeight(it, headerHeight) }
+    footerView?.let { footerHeight = measuredHeight(it, footerHeight) }
+  }
+
+  private fun measuredHeight(view: View, fallback: Int): Int {
+    val height = TrueSheetLayoutRegistry.getHeight(view.id)
+    return if (height == TrueSheetLayoutRegistry.UNKNOWN_HEIGHT) fallback else height.dpToPx().roundToInt()
+  }
+
   // ==================== Delegate Implementations ====================
 
   override fun contentViewDidChangeSize(width: Int, height: Int) {
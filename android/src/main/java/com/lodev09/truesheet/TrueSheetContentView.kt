@@ -14,6 +14,9 @@ import com.facebook.react.uimanager.ThemedReactContext
 import com.facebook.react.views.view.ReactViewGroup
 import com.lodev09.truesheet.core.TrueSheetKeyboardObserver
 import com.lodev09.truesheet.core.TrueSheetKeyboardObserverDelegate
+import com.lodev09.truesheet.core.TrueSheetLayoutRegistry
+import com.lodev09.truesheet.core.TrueSheetScrollExpansion
+import com.lodev09.truesheet.core.TrueSheetScrollExpansionDelegate
 import com.lodev09.truesheet.utils.isDescendantOf
 import com.lodev09.truesheet.utils.smoothScrollBy
 import com.lodev09.truesheet.utils.smoothScrollTo
@@ -34,16 +37,19 @@ interface TrueSheetContentViewDelegate {
  * This is the first child of TrueSheetContainerView
  */
 @SuppressLint("ViewConstructor")
-class TrueSheetContentView(private val reactContext: ThemedReactContext) : ReactViewGroup(reactContext) {
+class TrueSheetContentView(private val reactContext: ThemedReactContext) :
+  ReactViewGroup(reactContext),
+  TrueSheetScrollExpansionDelegate {
   var delegate: TrueSheetContentViewDelegate? = null
 
   private var lastWidth = 0
   private var lastHeight = 0
 
   private var pinnedScrollView: ViewGroup? = null
+  private var resolvedScrollView: ViewGroup? = null
   private var originalScrollViewPaddingBottom: Int = 0
   private var bottomInset: Int = 0
-  private var scrollExpansionPadding: Int = 0
+  private val scrollExpansion = TrueSheetScrollExpansion().apply { delegate = this@TrueSheetContentView }
 
   private var keyboardScrollOffset: Float = 0f
   private var keyboardObserver: TrueSheetKeyboardObserver? = null
@@ -99,7 +105,7 @@ class TrueSheetContentView(private val reactContext: ThemedReactContext) : React
       return
     }
 
-    val scrollView = findScrollView(this) ?: return
+    val scrollView = findScrollView() ?: return
 
     // Only capture originals on first pin
     if (pinnedScrollView == null) {
@@ -131,15 +137,28 @@ class TrueSheetContentView(private val reactContext: ThemedReactContext) : React
   // The container is currently sized to the largest detent, so at smaller detents the ScrollView
   // viewport extends beyond the visible area, reducing the effective scroll range. This padding
   // compensates for that difference until we can resize the container per-detent synchronously.
-  fun updateScrollExpansionPadding(padding: Int) {
-    if (scrollExpansionPadding == padding) return
-    scrollExpansionPadding = padding
+  fun updateScrollExpansionPadding(padding: Int, isSheetMoving: Boolean = false) {
+    scrollExpansion.update(padding, isSheetMoving)
+  }
+
+  override fun scrollExpansionApplyPadding(padding: Int) {
     val keyboardHeight = keyboardObserver?.currentHeight ?: 0
     val basePadding = if (keyboardHeight > 0) keyboardHeight else bottomInset
     setScrollViewPaddingBottom(originalScrollViewPaddingBottom + basePadding)
     nudgeScrollView()
   }
 
+  override fun scrollExpansionClampScroll(padding: Int) {
+    val scrollView = pinnedScrollView ?: return
+    val child = scrollView.getChildAt(0) ?: return
+
+    val paddingBottom = scrollView.paddingBottom - (scrollExpansion.padding - padding)
+    val maxScrollY = maxOf(0, child.height + scrollView.paddingTop + paddingBottom - scrollView.height)
+    if (scrollView.scrollY > maxScrollY) {
+      scrollView.scrollTo(scrollView.scrollX, maxScrollY)
+    }
+  }
+
   private fun setScrollViewPaddingBottom(paddingBottom: Int) {
     val scrollView = pinnedScrollView ?: return
     scrollView.clipToPadding = false
@@ -147,7 +166,7 @@ class TrueSheetContentView(private val reactContext: ThemedReactContext) : React
       scrollView.paddingLeft,
       scrollView.paddingTop,
       scrollView.paddingRight,
-      paddingBottom + scrollExpansionPadding
+      paddingBottom + scrollExpansion.padding
     )
   }
 
@@ -155,7 +174,7 @@ class TrueSheetContentView(private val reactContext: ThemedReactContext) : React
     pinnedScrollView?.setOnScrollChangeListener(null as View.OnScrollChangeListener?)
     pinnedScrollView?.isNestedScrollingEnabled = false
     (pinnedScrollView?.parent as? SwipeRefreshLayout)?.isNestedScrollingEnabled = true
-    scrollExpansionPadding = 0
+    scrollExpansion.reset()
     setScrollViewPaddingBottom(originalScrollViewPaddingBottom)
     pinnedScrollView = null
     originalScrollViewPaddingBottom = 0
@@ -164,7 +183,24 @@ class TrueSheetContentView(private val reactContext: ThemedReactContext) : React
 
   fun findScrollView(): ViewGroup? {
     if (pinnedScrollView != null) return pinnedScrollView
-    return findScrollView(this as View)
+
+    // The content shadow node publishes the first React Native ScrollView in its subtree.
+    // Other scroll views (e.g. a third-party NestedScrollView) and tags that aren't mounted yet
+    // fall back to searching the views.
+    return when (val scrollViewTag = TrueSheetLayoutRegistry.getScrollViewTag(id)) {
+      TrueSheetLayoutRegistry.UNKNOWN_SCROLL_VIEW,
+      TrueSheetLayoutRegistry.NO_SCROLL_VIEW -> findScrollView(this as View)
+      else -> resolveScrollView(scrollViewTag) ?: findScrollView(this as View)
+    }
+  }
+
+  private fun resolveScrollView(tag: Int): ViewGroup? {
+    resolvedScrollView?.let {
+      if (it.id == tag && it.isDescendantOf(this)) return it
+    }
+
+    resolvedScrollView = findViewById<View>(tag)?.takeIf { it is ScrollView || it is NestedScrollView } as? ViewGroup
+    return resolvedScrollView
   }
 
   private fun findScrollView(view: View): ViewGroup? {
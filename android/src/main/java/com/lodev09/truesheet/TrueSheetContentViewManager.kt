@@ -5,6 +5,7 @@ import com.facebook.react.uimanager.PointerEvents
 import com.facebook.react.uimanager.ThemedReactContext
 import com.facebook.react.uimanager.ViewGroupManager
 import com.facebook.react.uimanager.annotations.ReactProp
+import com.lodev09.truesheet.core.TrueSheetLayoutRegistry
 
 /**
  * ViewManager for TrueSheetContentView
@@ -17,6 +18,11 @@ class TrueSheetContentViewManager : ViewGroupManager<TrueSheetContentView>() {
 
   override fun createViewInstance(reactContext: ThemedReactContext): TrueSheetContentView = TrueSheetContentView(reactContext)
 
+  override fun onDropViewInstance(view: TrueSheetContentView) {
+    TrueSheetLayoutRegistry.remove(view.id)
+    super.onDropViewInstance(view)
+  }
+
   @ReactProp(name = "pointerEvents")
   fun setPointerEvents(view: TrueSheetContentView, pointerEventsStr: String?) {
     view.pointerEvents = PointerEvents.parsePointerEvents(pointerEventsStr)
@@ -5,6 +5,7 @@ import com.facebook.react.uimanager.PointerEvents
 import com.facebook.react.uimanager.ThemedReactContext
 import com.facebook.react.uimanager.ViewGroupManager
 import com.facebook.react.uimanager.annotations.ReactProp
+import com.lodev09.truesheet.core.TrueSheetLayoutRegistry
 
 /**
  * ViewManager for TrueSheetFooterView
@@ -17,6 +18,11 @@ class TrueSheetFooterViewManager : ViewGroupManager<TrueSheetFooterView>() {
 
   override fun createViewInstance(reactContext: ThemedReactContext): TrueSheetFooterView = TrueSheetFooterView(reactContext)
 
+  override fun onDropViewInstance(view: TrueSheetFooterView) {
+    TrueSheetLayoutRegistry.remove(view.id)
+    super.onDropViewInstance(view)
+  }
+
   @ReactProp(name = "pointerEvents")
   fun setPointerEvents(view: TrueSheetFooterView, pointerEventsStr: String?) {
     view.pointerEvents = PointerEvents.parsePointerEvents(pointerEventsStr)
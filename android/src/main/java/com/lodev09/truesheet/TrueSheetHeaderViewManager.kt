@@ -5,6 +5,7 @@ import com.facebook.react.uimanager.PointerEvents
 import com.facebook.react.uimanager.ThemedReactContext
 import com.facebook.react.uimanager.ViewGroupManager
 import com.facebook.react.uimanager.annotations.ReactProp
+import com.lodev09.truesheet.core.TrueSheetLayoutRegistry
 
 /**
  * ViewManager for TrueSheetHeaderView
@@ -17,6 +18,11 @@ class TrueSheetHeaderViewManager : ViewGroupManager<TrueSheetHeaderView>() {
 
   override fun createViewInstance(reactContext: ThemedReactContext): TrueSheetHeaderView = TrueSheetHeaderView(reactContext)
 
+  override fun onDropViewInstance(view: TrueSheetHeaderView) {
+    TrueSheetLayoutRegistry.remove(view.id)
+    super.onDropViewInstance(view)
+  }
+
   @ReactProp(name = "pointerEvents")
   fun setPointerEvents(view: TrueSheetHeaderView, pointerEventsStr: String?) {
     view.pointerEvents = PointerEvents.parsePointerEvents(pointerEventsStr)
@@ -2,13 +2,21 @@ package com.lodev09.truesheet
 
 import android.os.Handler
 import android.os.Looper
+import androidx.annotation.UiThread
 import com.facebook.react.bridge.Promise
 import com.facebook.react.bridge.ReactApplicationContext
 import com.facebook.react.bridge.ReactMethod
+import com.facebook.react.bridge.WritableMap
+import com.facebook.proguard.annotations.DoNotStrip
 import com.facebook.react.module.annotations.ReactModule
+import com.facebook.react.turbomodule.core.BindingsInstallerHolder
 import com.facebook.react.turbomodule.core.interfaces.TurboModule
+import com.facebook.react.turbomodule.core.interfaces.TurboModuleWithJSIBindings
 import com.facebook.react.uimanager.UIManagerHelper
+import com.facebook.soloader.SoLoader
+import com.lodev09.truesheet.core.TrueSheetMetrics
 import com.lodev09.truesheet.core.TrueSheetStackManager
+import com.lodev09.truesheet.core.TrueSheetViewPool
 import java.util.concurrent.ConcurrentHashMap
 
 /**
@@ -18,10 +26,96 @@ import java.util.concurrent.ConcurrentHashMap
 @ReactModule(name = TrueSheetModule.NAME)
 class TrueSheetModule(reactContext: ReactApplicationContext) :
   com.facebook.react.bridge.ReactContextBaseJavaModule(reactContext),
-  TurboModule {
+  TurboModule,
+  TurboModuleWithJSIBindings {
 
   override fun getName(): String = NAME
 
+  private val mainHandler = Handler(Looper.getMainLooper())
+
+  /**
+   * Installs the synchronous position channel (`__TrueSheetPositionChannel`) and
+   * command queue (`__TrueSheetCommands`) bindings.
+   */
+  override fun getBindingsInstaller(): BindingsInstallerHolder = getBindingsInstallerCxx()
+
+  @DoNotStrip
+  private external fun getBindingsInstallerCxx(): BindingsInstallerHolder
+
+  /**
+   * Takes the pending command batch, flattened as [COMMAND_STRIDE] ints per command, with the
+   * commands superseded by later ones for the same sheet marked.
+   */
+  @DoNotStrip
+  private external fun drainCommandsCxx(presentedTags: IntArray): IntArray
+
+  /**
+   * Settles a drained command on the JS side when its sheet is gone and can't report it.
+   */
+  @DoNotStrip
+  private external fun failCommandCxx(owner: Int, commandId: Int, error: String)
+
+  /**
+   * Called from the JS thread when the first command of a batch is queued.
+   * Commands queued until the main thread gets to it join the same batch.
+   */
+  @DoNotStrip
+  @Suppress("unused")
+  private fun scheduleCommandDrain() {
+    mainHandler.post { runCommands() }
+  }
+
+  @UiThread
+  private fun runCommands() {
+    val presentedTags = viewRegistry.entries.filter { it.value.viewController.isPresented }.map { it.key }
+    val commands = drainCommandsCxx(presentedTags.toIntArray())
+    var offset = 0
+    while (offset + COMMAND_STRIDE <= commands.size) {
+      runCommand(
+        tag = commands[offset],
+        type = commands[offset + 1],
+        index = commands[offset + 2],
+        animated = commands[offset + 3] != 0,
+        commandId = commands[offset + 4],
+        superseded = commands[offset + 5] != 0,
+        owner = commands[offset + 6]
+      )
+      offset += COMMAND_STRIDE
+    }
+  }
+
+  /**
+   * Runs a queued command. Completion is reported with the sheet's `onCommandComplete` event
+   * instead of a promise, or through the command queue when the sheet is no longer registered.
+   */
+  @UiThread
+  private fun runCommand(tag: Int, type: Int, index: Int, animated: Boolean, commandId: Int, superseded: Boolean, owner: Int) {
+    val view = getSheetByTag(tag)
+    if (view == null) {
+      failCommandCxx(owner, commandId, "No sheet found with tag $tag")
+      return
+    }
+
+    if (superseded) {
+      view.dispatchCommandComplete(commandId, superseded = true)
+      return
+    }
+
+    val complete = { view.dispatchCommandComplete(commandId) }
+
+    try {
+      when (type) {
+        COMMAND_PRESENT -> view.present(index, animated, complete)
+        COMMAND_RESIZE -> view.resize(index, complete)
+        COMMAND_DISMISS -> view.dismiss(animated, complete)
+        COMMAND_DISMISS_STACK -> view.dismissStack(animated, complete)
+        else -> view.dispatchCommandComplete(commandId, "Unknown command type $type")
+      }
+    } catch (e: Exception) {
+      view.dispatchCommandComplete(commandId, "Failed to execute command: ${e.message}")
+    }
+  }
+
   override fun invalidate() {
     super.invalidate()
     // Clear all registered views and observer on module invalidation
@@ -29,6 +123,7 @@ class TrueSheetModule(reactContext: ReactApplicationContext) :
       viewRegistry.clear()
     }
     TrueSheetStackManager.clear()
+    Handler(Looper.getMainLooper()).post { TrueSheetViewPool.clear() }
   }
 
   /**
@@ -150,6 +245,17 @@ class TrueSheetModule(reactContext: ReactApplicationContext) :
     }
   }
 
+  /**
+   * Snapshot of the shared performance counters and latency histograms
+   */
+  @ReactMethod(isBlockingSynchronousMethod = true)
+  fun getMetrics(): WritableMap = TrueSheetMetrics.getSnapshot()
+
+  @ReactMethod
+  fun resetMetrics() {
+    TrueSheetMetrics.reset()
+  }
+
   /**
    * Helper method to get TrueSheetView by tag and execute closure
    */
@@ -190,6 +296,17 @@ class TrueSheetModule(reactContext: ReactApplicationContext) :
   companion object {
     const val NAME = "TrueSheetModule"
 
+    // Must match `TrueSheetCommandType` and `JTrueSheetModule::kCommandStride` in C++
+    private const val COMMAND_STRIDE = 7
+    private const val COMMAND_PRESENT = 0
+    private const val COMMAND_RESIZE = 1
+    private const val COMMAND_DISMISS = 2
+    private const val COMMAND_DISMISS_STACK = 3
+
+    init {
+      SoLoader.loadLibrary("react_codegen_TrueSheetSpec")
+    }
+
     /**
      * Registry to keep track of TrueSheetView instances by their view tag
      * This provides fast lookup for ref-based operations
@@ -1,17 +1,20 @@
 package com.lodev09.truesheet
 
 import android.annotation.SuppressLint
+import android.os.SystemClock
 import android.view.View
 import android.view.ViewGroup
 import android.view.accessibility.AccessibilityEvent
+import android.view.animation.AnimationUtils
 import androidx.annotation.UiThread
 import com.facebook.react.bridge.LifecycleEventListener
-import com.facebook.react.bridge.WritableNativeMap
+import com.facebook.react.bridge.UiThreadUtil
 import com.facebook.react.uimanager.PixelUtil.dpToPx
 import com.facebook.react.uimanager.PixelUtil.pxToDp
 import com.facebook.react.uimanager.StateWrapper
 import com.facebook.react.uimanager.ThemedReactContext
 import com.facebook.react.uimanager.UIManagerHelper
+import com.facebook.react.uimanager.events.BatchEventDispatchedListener
 import com.facebook.react.uimanager.events.EventDispatcher
 import com.facebook.react.util.RNLog
 import com.facebook.react.views.view.ReactViewGroup
@@ -19,7 +22,26 @@ import com.lodev09.truesheet.core.AccessibilityOptions
 import com.lodev09.truesheet.core.GrabberOptions
 import com.lodev09.truesheet.core.RNScreensEventObserver
 import com.lodev09.truesheet.core.RNScreensEventObserverDelegate
+import com.lodev09.truesheet.core.TrueSheetDirtyStages
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_ALL
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_BACKGROUND
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_DETENTS
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_ELEVATION
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_GRABBER
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_GRAVITY
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_MAX_WIDTH
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_SCROLLABLE
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.PropStages
+import com.lodev09.truesheet.core.TrueSheetDrainSignal
+import com.lodev09.truesheet.core.TrueSheetDrainSignalDelegate
+import com.lodev09.truesheet.core.TrueSheetEventCoalescer
+import com.lodev09.truesheet.core.TrueSheetEventCoalescerDelegate
+import com.lodev09.truesheet.core.TrueSheetMetrics
+import com.lodev09.truesheet.core.TrueSheetPositionChannel
+import com.lodev09.truesheet.core.TrueSheetPositionSampler
 import com.lodev09.truesheet.core.TrueSheetStackManager
+import com.lodev09.truesheet.core.TrueSheetViewPool
+import com.lodev09.truesheet.core.TrueSheetViewState
 import com.lodev09.truesheet.events.*
 import com.lodev09.truesheet.utils.KeyboardUtils
 
@@ -34,21 +56,39 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
   LifecycleEventListener,
   TrueSheetViewControllerDelegate,
   TrueSheetContainerViewDelegate,
+  TrueSheetEventCoalescerDelegate,
+  TrueSheetDrainSignalDelegate,
+  BatchEventDispatchedListener,
   RNScreensEventObserverDelegate {
 
   // ==================== Properties ====================
 
   internal val viewController: TrueSheetViewController = TrueSheetViewController(reactContext)
   override var eventDispatcher: EventDispatcher? = null
+    set(value) {
+      field?.removeBatchEventDispatchedListener(this)
+      field = value
+      value?.addBatchEventDispatchedListener(this)
+    }
 
   // Initial present configuration (set by ViewManager before mount)
   var initialDetentIndex: Int = -1
   var initialDetentAnimated: Boolean = true
   private var didInitiallyPresent: Boolean = false
 
+  // Present requested through props, run once the container mounts (see presentRequestedSheetIfNeeded)
+  private var presentRequestIndex: Int = -1
+  private var presentRequestAnimated: Boolean = true
+  private var presentRequestId: Int = 0
+  private var handledPresentRequestId: Int = 0
+
   private var lastContainerWidth: Int = 0
   private var lastContainerHeight: Int = 0
 
+  // Latency start times for TrueSheetMetrics (elapsed realtime nanos, 0 when idle)
+  private var presentStartTime: Long = 0
+  private var dismissStartTime: Long = 0
+
   var stateWrapper: StateWrapper? = null
     set(value) {
       field = value
@@ -60,6 +100,9 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
       }
     }
 
+  // Stages invalidated since the last finalizeUpdates
+  private val dirtyStages = TrueSheetDirtyStages()
+
   // Debounce flag to coalesce rapid layout changes into a single sheet update
   private var isSheetUpdatePending: Boolean = false
 
@@ -69,11 +112,25 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
   // Screen event observer for react-native-screens integration
   internal var screensEventObserver: RNScreensEventObserver? = null
 
+  // Latest-wins delivery for position and drag change samples
+  private val eventCoalescer = TrueSheetEventCoalescer()
+
+  // Every position sample, readable synchronously from JS and worklets
+  private val positionChannel = TrueSheetPositionChannel()
+
+  // Applies positionChangePolicy to onPositionChange only; the position channel gets every sample
+  private val positionSampler = TrueSheetPositionSampler()
+
+  // Tells the coalescer when JS has caught up, driven by the event beat
+  private val drainSignal = TrueSheetDrainSignal()
+
   // ==================== Initialization ====================
 
   init {
     reactContext.addLifecycleEventListener(this)
     viewController.delegate = this
+    eventCoalescer.delegate = this
+    drainSignal.delegate = this
 
     // Hide the host view - actual content is rendered in the dialog window
     visibility = GONE
@@ -95,6 +152,7 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
     super.setId(id)
     viewController.id = id
     TrueSheetModule.registerView(this, id)
+    positionChannel.registerTag(id)
   }
 
   // ==================== View Hierarchy Management ====================
@@ -102,6 +160,8 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
   override fun onAttachedToWindow() {
     super.onAttachedToWindow()
 
+    presentRequestedSheetIfNeeded()
+
     if (initialDetentIndex >= 0 && !didInitiallyPresent) {
       didInitiallyPresent = true
       if (initialDetentAnimated) {
@@ -121,8 +181,10 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
 
     if (child is TrueSheetContainerView) {
       child.delegate = this
+      TrueSheetViewPool.prewarm(reactContext)
       val surfaceId = UIManagerHelper.getSurfaceId(this)
       eventDispatcher?.dispatchEvent(MountEvent(surfaceId, id))
+      presentRequestedSheetIfNeeded()
     }
   }
 
@@ -154,6 +216,7 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
 
   override fun onHostResume() {
     viewController.reapplyHiddenState()
+    dirtyStages.mark(STAGE_ALL)
     finalizeUpdates()
   }
 
@@ -167,12 +230,22 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
     reactContext.removeLifecycleEventListener(this)
 
     TrueSheetModule.unregisterView(id)
+    positionChannel.unregisterTag(id)
     TrueSheetStackManager.removeSheet(this)
 
     cleanupScreenEventObserver()
+    // Keep the dispatcher for the dismiss events below, only stop driving the drain
+    eventDispatcher?.removeBatchEventDispatchedListener(this)
+    drainSignal.cancel()
     didInitiallyPresent = false
+    handledPresentRequestId = 0
 
-    viewController.dismissPromise = { viewController.delegate = null }
+    // A stack dismissal in flight still has to dismiss the sheets below
+    val pendingDismiss = viewController.dismissPromise
+    viewController.dismissPromise = {
+      pendingDismiss?.invoke()
+      viewController.delegate = null
+    }
 
     if (viewController.isPresented && !viewController.isBeingDismissed) {
       viewController.dismiss(animated = false)
@@ -181,41 +254,55 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
 
   /**
    * Called by the ViewManager after all properties are set.
-   * Reconfigures the sheet if it's currently presented.
+   * Runs the stages invalidated by this transaction; the sheet is only reconfigured if presented.
    */
   fun finalizeUpdates() {
-    setupScrollable()
+    finalizePropStages()
+    presentRequestedSheetIfNeeded()
+  }
 
-    if (viewController.isPresented) {
-      viewController.sheetView?.setupBackground()
-      viewController.sheetView?.setupGrabber()
-      viewController.sheetView?.updateGravity()
-      viewController.updateBehaviorMaxWidth()
-      updateSheetIfNeeded()
-    }
+  private fun finalizePropStages() {
+    val stages = dirtyStages.take()
+    if (stages == 0) return
+
+    if (stages and STAGE_SCROLLABLE != 0) setupScrollable()
+
+    if (!viewController.isPresented) return
+
+    val sheetView = viewController.sheetView
+    if (stages and STAGE_BACKGROUND != 0) sheetView?.setupBackground()
+    if (stages and STAGE_ELEVATION != 0) sheetView?.setupElevation()
+    if (stages and STAGE_GRABBER != 0) sheetView?.setupGrabber()
+    if (stages and STAGE_GRAVITY != 0) sheetView?.updateGravity()
+    if (stages and STAGE_MAX_WIDTH != 0) viewController.updateBehaviorMaxWidth()
+    if (stages and STAGE_DETENTS != 0) updateSheetIfNeeded()
+
+    TrueSheetMetrics.recordPropTransaction(Integer.bitCount(stages))
   }
 
   // ==================== Property Setters ====================
 
+  fun setPresentRequest(index: Int, animated: Boolean, requestId: Int) {
+    presentRequestIndex = index
+    presentRequestAnimated = animated
+    presentRequestId = requestId
+  }
+
   fun setMaxContentHeight(height: Int?) {
-    if (viewController.maxContentHeight == height) return
-    viewController.maxContentHeight = height
+    dirtyStages.update(viewController.maxContentHeight, height, PropStages.MAX_CONTENT_HEIGHT) { viewController.maxContentHeight = it }
   }
 
   fun setMaxContentWidth(width: Int?) {
-    if (viewController.maxContentWidth == width) return
-    viewController.maxContentWidth = width
+    dirtyStages.update(viewController.maxContentWidth, width, PropStages.MAX_CONTENT_WIDTH) { viewController.maxContentWidth = it }
   }
 
   fun setAnchor(anchor: String?) {
     val value = TrueSheetAnchor.fromString(anchor)
-    if (viewController.anchor == value) return
-    viewController.anchor = value
+    dirtyStages.update(viewController.anchor, value, PropStages.ANCHOR) { viewController.anchor = it }
   }
 
   fun setAnchorOffset(offset: Int) {
-    if (viewController.anchorOffset == offset) return
-    viewController.anchorOffset = offset
+    dirtyStages.update(viewController.anchorOffset, offset, PropStages.ANCHOR_OFFSET) { viewController.anchorOffset = it }
   }
 
   fun setDimmed(dimmed: Boolean) {
@@ -239,13 +326,11 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
   }
 
   fun setCornerRadius(radius: Float) {
-    if (viewController.sheetCornerRadius == radius) return
-    viewController.sheetCornerRadius = radius
+    dirtyStages.update(viewController.sheetCornerRadius, radius, PropStages.CORNER_RADIUS) { viewController.sheetCornerRadius = it }
   }
 
   fun setSheetBackgroundColor(color: Int?) {
-    if (viewController.sheetBackgroundColor == color) return
-    viewController.sheetBackgroundColor = color
+    dirtyStages.update(viewController.sheetBackgroundColor, color, PropStages.BACKGROUND_COLOR) { viewController.sheetBackgroundColor = it }
   }
 
   fun setDismissible(dismissible: Boolean) {
@@ -253,42 +338,42 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
   }
 
   fun setDraggable(draggable: Boolean) {
-    viewController.draggable = draggable
+    dirtyStages.update(viewController.draggable, draggable, PropStages.DRAGGABLE) { viewController.draggable = it }
   }
 
   fun setGrabber(grabber: Boolean) {
-    viewController.grabber = grabber
+    dirtyStages.update(viewController.grabber, grabber, PropStages.GRABBER) { viewController.grabber = it }
   }
 
   fun setGrabberOptions(options: GrabberOptions?) {
-    viewController.grabberOptions = options
+    dirtyStages.update(viewController.grabberOptions, options, PropStages.GRABBER_OPTIONS) { viewController.grabberOptions = it }
   }
 
   fun setAccessibilityOptions(options: AccessibilityOptions?) {
-    viewController.accessibilityOptions = options
+    dirtyStages.update(viewController.accessibilityOptions, options, PropStages.ACCESSIBILITY_OPTIONS) {
+      viewController.accessibilityOptions = it
+    }
   }
 
   fun setSheetElevation(elevation: Float) {
-    viewController.sheetElevation = elevation
+    dirtyStages.update(viewController.sheetElevation, elevation, PropStages.ELEVATION) { viewController.sheetElevation = it }
   }
 
   fun setDetents(newDetents: MutableList<Double>) {
-    viewController.detents = newDetents
+    dirtyStages.update(viewController.detents, newDetents, PropStages.DETENTS) { viewController.detents = it }
   }
 
   fun setInsetAdjustment(insetAdjustment: String) {
-    viewController.insetAdjustment = TrueSheetInsetAdjustment.fromString(insetAdjustment)
-    setupScrollable()
+    val value = TrueSheetInsetAdjustment.fromString(insetAdjustment)
+    dirtyStages.update(viewController.insetAdjustment, value, PropStages.INSET_ADJUSTMENT) { viewController.insetAdjustment = it }
   }
 
   fun setScrollable(scrollable: Boolean) {
-    viewController.scrollable = scrollable
-    setupScrollable()
+    dirtyStages.update(viewController.scrollable, scrollable, PropStages.SCROLLABLE) { viewController.scrollable = it }
   }
 
   fun setScrollableOptions(options: ScrollableOptions?) {
-    viewController.scrollableOptions = options
-    setupScrollable()
+    dirtyStages.update(viewController.scrollableOptions, options, PropStages.SCROLLABLE_OPTIONS) { viewController.scrollableOptions = it }
   }
 
   fun setFooterKeyboardOffset(offset: Float) {
@@ -296,6 +381,10 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
     viewController.positionFooter()
   }
 
+  fun setPositionChangePolicy(settledOnly: Boolean, maxHz: Double, minDelta: Double) {
+    positionSampler.setPolicy(settledOnly, maxHz, minDelta)
+  }
+
   private fun setupScrollable() {
     viewController.containerView?.let {
       it.insetAdjustment = viewController.insetAdjustment
@@ -334,7 +423,7 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
 
   /**
    * Updates the Fabric state with container dimensions for Yoga layout.
-   * Converts pixel values to density-independent pixels (dp).
+   * Converts pixel values to density-independent pixels (dp) and skips sizes the committed state already has.
    */
   fun updateState(width: Int, height: Int) {
     if (width == lastContainerWidth && height == lastContainerHeight) return
@@ -343,10 +432,12 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
     lastContainerHeight = height
 
     val sw = stateWrapper ?: return
-    val newStateData = WritableNativeMap()
-    newStateData.putDouble("containerWidth", width.toFloat().pxToDp().toDouble())
-    newStateData.putDouble("containerHeight", height.toFloat().pxToDp().toDouble())
-    sw.updateState(newStateData)
+    val widthDp = width.toFloat().pxToDp()
+    val heightDp = height.toFloat().pxToDp()
+    if (TrueSheetViewState.hasContainerSize(sw, widthDp, heightDp)) return
+
+    TrueSheetViewState.updateContainerSize(sw, widthDp, heightDp)
+    TrueSheetMetrics.recordStateUpdate()
   }
 
   // ==================== Sheet Actions ====================
@@ -359,6 +450,9 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
       return
     }
 
+    // Keep the original start when re-entering after the keyboard is dismissed
+    if (presentStartTime == 0L) presentStartTime = SystemClock.elapsedRealtimeNanos()
+
     viewController.createSheet()
     setupScrollable()
 
@@ -381,10 +475,41 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
     // Register with observer to track sheet stack hierarchy
     viewController.parentSheetView = TrueSheetStackManager.registerSheet(this)
 
+    viewController.containerView?.syncMeasuredHeights()
     viewController.presentPromise = promiseCallback
     viewController.present(detentIndex, animated)
   }
 
+  /**
+   * Runs a present requested through the `presentRequest` prop once the container has mounted.
+   * A cold `present()` mounts the container and requests the present in the same commit, so it
+   * skips the round trip through [TrueSheetModule]. Whichever of the props update and the
+   * container mount lands last in the transaction triggers it. The request id is a command id,
+   * so completion is reported through `onCommandComplete`.
+   */
+  private fun presentRequestedSheetIfNeeded() {
+    if (presentRequestIndex < 0 || presentRequestId == handledPresentRequestId) return
+
+    // Retried from onAttachedToWindow
+    if (viewController.containerView == null || !isAttachedToWindow) return
+
+    val requestId = presentRequestId
+    handledPresentRequestId = requestId
+    try {
+      present(presentRequestIndex, presentRequestAnimated) { dispatchCommandComplete(requestId) }
+    } catch (e: Exception) {
+      dispatchCommandComplete(requestId, "Failed to present sheet: ${e.message}")
+    }
+  }
+
+  /**
+   * Reports a finished command from the JSI command queue to JS.
+   */
+  fun dispatchCommandComplete(commandId: Int, error: String? = null, superseded: Boolean = false) {
+    val surfaceId = UIManagerHelper.getSurfaceId(this)
+    eventDispatcher?.dispatchEvent(CommandCompleteEvent(surfaceId, id, commandId, error, superseded))
+  }
+
   @UiThread
   fun handleBackPress() {
     viewController.handleBackPress()
@@ -398,10 +523,14 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
       return
     }
 
-    // Dismiss all sheets above first
-    dismissStack(animated) {}
+    dismissStartTime = SystemClock.elapsedRealtimeNanos()
+
+    val sheetsAbove = TrueSheetStackManager.getSheetsAbove(this)
+    if (sheetsAbove.isNotEmpty()) {
+      dismissTogether(sheetsAbove + this, animated, promiseCallback)
+      return
+    }
 
-    // Then dismiss itself
     viewController.dismissPromise = promiseCallback
     viewController.dismiss(animated)
   }
@@ -415,14 +544,49 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
     }
 
     val sheetsAbove = TrueSheetStackManager.getSheetsAbove(this)
-    // Create snapshot only for topmost sheet (first in reversed list)
-    sheetsAbove.firstOrNull()?.viewController?.createSheetSnapshot()
+    if (sheetsAbove.isEmpty()) {
+      promiseCallback()
+      return
+    }
+
+    dismissTogether(sheetsAbove, animated, promiseCallback)
+  }
+
+  /**
+   * Dismisses [sheets] (topmost first) in one animation. Only the topmost sheet animates out, the
+   * ones below are hidden right away and dismissed without animation once it's gone, top-down, so
+   * their dismiss events arrive as one ordered batch instead of interleaved per-sheet animations.
+   */
+  private fun dismissTogether(sheets: List<TrueSheetView>, animated: Boolean, promiseCallback: () -> Unit) {
+    val topmost = sheets.first()
+    val below = sheets.drop(1)
 
-    for (sheet in sheetsAbove) {
-      sheet.viewController.dismiss(animated)
+    val controller = topmost.viewController
+
+    controller.createSheetSnapshot()
+    for (sheet in below) {
+      sheet.viewController.hideForStackDismiss()
+    }
+
+    // Chain onto a dismissal already in flight instead of replacing its callback
+    val pendingDismiss = controller.dismissPromise
+    controller.dismissPromise = {
+      pendingDismiss?.invoke()
+      for (sheet in below) {
+        sheet.viewController.dismiss(false)
+      }
+      promiseCallback()
     }
+    controller.dismiss(animated)
 
-    promiseCallback()
+    // The topmost didn't start dismissing, so the sheets below stay presented
+    if (controller.isPresented && !controller.isBeingDismissed) {
+      controller.dismissPromise = pendingDismiss
+      for (sheet in below) {
+        sheet.viewController.cancelStackDismiss()
+      }
+      promiseCallback()
+    }
   }
 
   @UiThread
@@ -513,12 +677,22 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
 
   override fun viewControllerDidPresent(index: Int, position: Float, detent: Float) {
     setupScreenEventObserver()
+    eventCoalescer.flush()
 
     val surfaceId = UIManagerHelper.getSurfaceId(this)
     eventDispatcher?.dispatchEvent(DidPresentEvent(surfaceId, id, index, position, detent))
+
+    if (presentStartTime != 0L) {
+      TrueSheetMetrics.recordPresentLatency(elapsedMillisSince(presentStartTime))
+      presentStartTime = 0
+    }
   }
 
   override fun viewControllerWillDismiss() {
+    // Swipe, back press and stack dismissals start here
+    if (dismissStartTime == 0L) dismissStartTime = SystemClock.elapsedRealtimeNanos()
+
+    eventCoalescer.flush()
     val surfaceId = UIManagerHelper.getSurfaceId(this)
     eventDispatcher?.dispatchEvent(WillDismissEvent(surfaceId, id))
   }
@@ -529,21 +703,29 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
     rootContainerView = null
 
     cleanupScreenEventObserver()
+    eventCoalescer.flush()
+    positionSampler.reset()
 
     val surfaceId = UIManagerHelper.getSurfaceId(this)
     eventDispatcher?.dispatchEvent(DidDismissEvent(surfaceId, id))
 
+    if (dismissStartTime != 0L) {
+      TrueSheetMetrics.recordDismissLatency(elapsedMillisSince(dismissStartTime))
+      dismissStartTime = 0
+    }
+
     TrueSheetStackManager.unregisterSheet(this)
 
     parent?.resetTranslation {
       val parentController = parent.viewController
-      if (parentController.isPresented && !parentController.isBeingDismissed) {
+      if (parentController.isPresented && !parentController.isBeingDismissed && !parentController.isPendingStackDismiss) {
         parent.viewControllerDidFocus()
       }
     }
   }
 
   override fun viewControllerDidChangeDetent(index: Int, position: Float, detent: Float) {
+    eventCoalescer.flush()
     val surfaceId = UIManagerHelper.getSurfaceId(this)
     eventDispatcher?.dispatchEvent(DetentChangeEvent(surfaceId, id, index, position, detent))
   }
@@ -554,18 +736,26 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
   }
 
   override fun viewControllerDidDragChange(index: Int, position: Float, detent: Float) {
-    val surfaceId = UIManagerHelper.getSurfaceId(this)
-    eventDispatcher?.dispatchEvent(DragChangeEvent(surfaceId, id, index, position, detent))
+    eventCoalescer.offerDragChange(index, position, detent, AnimationUtils.currentAnimationTimeMillis().toDouble())
   }
 
   override fun viewControllerDidDragEnd(index: Int, position: Float, detent: Float) {
+    eventCoalescer.flush()
     val surfaceId = UIManagerHelper.getSurfaceId(this)
     eventDispatcher?.dispatchEvent(DragEndEvent(surfaceId, id, index, position, detent))
   }
 
-  override fun viewControllerDidChangePosition(index: Float, position: Float, detent: Float, realtime: Boolean) {
+  override fun viewControllerWillSettle(index: Int, position: Float, detent: Float, duration: Int) {
+    eventCoalescer.flush()
     val surfaceId = UIManagerHelper.getSurfaceId(this)
-    eventDispatcher?.dispatchEvent(PositionChangeEvent(surfaceId, id, index, position, detent, realtime))
+    eventDispatcher?.dispatchEvent(WillSettleEvent(surfaceId, id, index, position, detent, duration))
+  }
+
+  override fun viewControllerDidChangePosition(index: Float, position: Float, detent: Float, realtime: Boolean) {
+    val timestamp = AnimationUtils.currentAnimationTimeMillis().toDouble()
+    positionChannel.write(index.toDouble(), position.toDouble(), detent.toDouble(), timestamp, realtime)
+    if (!positionSampler.shouldEmit(position.toDouble(), realtime, timestamp)) return
+    eventCoalescer.offerPositionChange(index, position, detent, realtime, timestamp)
   }
 
   override fun viewControllerDidChangeSize(width: Int, height: Int) {
@@ -600,6 +790,52 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
     eventDispatcher?.dispatchEvent(VisibilityChangeEvent(surfaceId, id, visible))
   }
 
+  // ==================== TrueSheetEventCoalescerDelegate ====================
+
+  override fun coalescerDispatchPositionChange(
+    index: Float,
+    position: Float,
+    detent: Float,
+    realtime: Boolean,
+    sequence: Int,
+    timestamp: Double
+  ) {
+    TrueSheetMetrics.recordPositionEmitted()
+    val surfaceId = UIManagerHelper.getSurfaceId(this)
+    eventDispatcher?.dispatchEvent(
+      PositionChangeEvent.obtain(surfaceId, id, index, position, detent, realtime, sequence, timestamp)
+    )
+  }
+
+  override fun coalescerDispatchDragChange(index: Int, position: Float, detent: Float, sequence: Int, timestamp: Double) {
+    val surfaceId = UIManagerHelper.getSurfaceId(this)
+    eventDispatcher?.dispatchEvent(DragChangeEvent.obtain(surfaceId, id, index, position, detent, sequence, timestamp))
+  }
+
+  override fun coalescerDidDropPositionChange() {
+    TrueSheetMetrics.recordPositionCoalesced()
+  }
+
+  override fun coalescerAwaitDrain(callback: Runnable) {
+    drainSignal.await(callback)
+  }
+
+  // ==================== TrueSheetDrainSignalDelegate ====================
+
+  override fun drainSignalRunOnJSQueue(task: Runnable) {
+    reactContext.runOnJSQueueThread(task)
+  }
+
+  override fun drainSignalRunOnUiThread(task: Runnable) {
+    UiThreadUtil.runOnUiThread(task)
+  }
+
+  // ==================== BatchEventDispatchedListener ====================
+
+  override fun onBatchEventDispatched() {
+    drainSignal.onBatchEventDispatched()
+  }
+
   // ==================== TrueSheetContainerViewDelegate ====================
 
   override fun containerViewContentDidChangeSize(width: Int, height: Int) {
@@ -668,4 +904,6 @@ class TrueSheetView(private val reactContext: ThemedReactContext) :
 
     return reactContext.currentActivity?.findViewById(android.R.id.content)
   }
+
+  private fun elapsedMillisSince(startNanos: Long): Double = (SystemClock.elapsedRealtimeNanos() - startNanos) / 1_000_000.0
 }
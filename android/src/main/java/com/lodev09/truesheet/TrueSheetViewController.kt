@@ -36,7 +36,11 @@ import com.lodev09.truesheet.core.TrueSheetDimView
 import com.lodev09.truesheet.core.TrueSheetDimViewDelegate
 import com.lodev09.truesheet.core.TrueSheetKeyboardObserver
 import com.lodev09.truesheet.core.TrueSheetKeyboardObserverDelegate
+import com.lodev09.truesheet.core.TrueSheetMetrics
+import com.lodev09.truesheet.core.TrueSheetSettlePredictor
 import com.lodev09.truesheet.core.TrueSheetStackManager
+import com.lodev09.truesheet.core.TrueSheetViewPool
+import com.lodev09.truesheet.utils.Insets
 import com.lodev09.truesheet.utils.KeyboardUtils
 import com.lodev09.truesheet.utils.ScreenUtils
 import com.lodev09.truesheet.utils.TouchEventDeduper
@@ -58,6 +62,7 @@ interface TrueSheetViewControllerDelegate {
   fun viewControllerDidDragBegin(index: Int, position: Float, detent: Float)
   fun viewControllerDidDragChange(index: Int, position: Float, detent: Float)
   fun viewControllerDidDragEnd(index: Int, position: Float, detent: Float)
+  fun viewControllerWillSettle(index: Int, position: Float, detent: Float, duration: Int)
   fun viewControllerDidChangePosition(index: Float, position: Float, detent: Float, realtime: Boolean)
   fun viewControllerDidChangeSize(width: Int, height: Int)
   fun viewControllerWillFocus()
@@ -122,6 +127,9 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
     private const val TRANSLATE_ANIMATION_DURATION = 200L
     private const val DISMISS_DURATION = 200L
     private const val SCREEN_FADE_DURATION = 150L
+
+    // Sentinel for an unspecified sheet top; avoids boxing a nullable Int on the drag path
+    private const val UNKNOWN_SHEET_TOP = Int.MIN_VALUE
   }
 
   // =============================================================================
@@ -164,6 +172,10 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   private var interactionState: InteractionState = InteractionState.Idle
   internal var isBeingDismissed = false
     private set
+
+  // Hidden below a sheet that animates the dismissal of the stack, dismissed once it's gone
+  internal var isPendingStackDismiss = false
+    private set
   var wasHiddenByScreen = false
   private var shouldAnimatePresent = false
   private var isPresentAnimating = false
@@ -222,6 +234,10 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   var insetAdjustment: TrueSheetInsetAdjustment = TrueSheetInsetAdjustment.AUTOMATIC
 
   var scrollable: Boolean = false
+    set(value) {
+      field = value
+      if (isPresented) sheetView?.let { updateScrollExpansionPadding(it.top) }
+    }
 
   var scrollableOptions: ScrollableOptions? = null
     set(value) {
@@ -233,26 +249,20 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   override var sheetCornerRadius: Float = DEFAULT_CORNER_RADIUS.dpToPx()
     set(value) {
       field = if (value < 0) DEFAULT_CORNER_RADIUS.dpToPx() else value
-      if (isPresented) sheetView?.setupBackground()
     }
 
   override var sheetElevation: Float = -1f
-    set(value) {
-      field = value
-      if (isPresented) sheetView?.setupElevation()
-    }
 
   var dismissible: Boolean = true
     set(value) {
       field = value
-      behavior?.isHideable = value
+      updateHideable()
     }
 
   override var draggable: Boolean = true
     set(value) {
       field = value
       behavior?.isDraggable = value
-      if (isPresented) sheetView?.setupGrabber()
     }
 
   // =============================================================================
@@ -275,7 +285,27 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
 
   // Includes system bars for accurate positioning
   override val realScreenHeight: Int
-    get() = ScreenUtils.getRealScreenHeight(reactContext)
+    get() {
+      if (sheetView == null) return ScreenUtils.getRealScreenHeight(reactContext)
+      if (cachedRealScreenHeight < 0) cachedRealScreenHeight = ScreenUtils.getRealScreenHeight(reactContext)
+      return cachedRealScreenHeight
+    }
+
+  // Window metrics allocate on every read, so they are cached while the sheet is hosted.
+  // Layout and configuration changes of the coordinator and every settle invalidate them.
+  private var cachedRealScreenHeight = -1
+  private var cachedInsets: Insets? = null
+
+  private val insets: Insets
+    get() {
+      if (sheetView == null) return ScreenUtils.getInsets(reactContext)
+      return cachedInsets ?: ScreenUtils.getInsets(reactContext).also { cachedInsets = it }
+    }
+
+  private fun invalidateScreenMetrics() {
+    cachedRealScreenHeight = -1
+    cachedInsets = null
+  }
 
   // Content Measurements
   // Cached values used during dismiss when container is unmounted
@@ -314,10 +344,10 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   }
 
   val bottomInset: Int
-    get() = if (edgeToEdgeEnabled) ScreenUtils.getInsets(reactContext).bottom else 0
+    get() = if (edgeToEdgeEnabled) insets.bottom else 0
 
   override val topInset: Int
-    get() = if (edgeToEdgeEnabled) ScreenUtils.getInsets(reactContext).top else 0
+    get() = if (edgeToEdgeEnabled) insets.top else 0
 
   override val contentBottomInset: Int
     get() = if (insetAdjustment == TrueSheetInsetAdjustment.AUTOMATIC) bottomInset else 0
@@ -345,9 +375,6 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
       return TrueSheetStackManager.isTopmostSheet(hostView)
     }
 
-  private val dimViews: List<TrueSheetDimView>
-    get() = listOfNotNull(dimView, parentDimView)
-
   val isDimmedAtCurrentDetent: Boolean
     get() = isDimmedAtDetentIndex(currentDetentIndex)
 
@@ -360,14 +387,15 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   fun createSheet() {
     if (coordinatorLayout != null) return
 
-    // Create coordinator layout
-    coordinatorLayout = TrueSheetCoordinatorLayout(reactContext).apply {
+    // Reuse pooled hosts when available
+    coordinatorLayout = TrueSheetViewPool.acquireCoordinatorLayout(reactContext).apply {
       delegate = this@TrueSheetViewController
     }
 
-    sheetView = TrueSheetBottomSheetView(reactContext).apply {
+    sheetView = TrueSheetViewPool.acquireSheetView(reactContext).apply {
       delegate = this@TrueSheetViewController
     }
+    invalidateScreenMetrics()
   }
 
   private fun cleanupSheet() {
@@ -387,11 +415,22 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
     sheetView?.removeView(this)
 
     containerView?.cleanupKeyboardHandler()
+
+    // Return hosts to the pool for the next present
+    val coordinator = coordinatorLayout
+    val sheet = sheetView
+    coordinator?.visibility = VISIBLE
+    if (coordinator != null && sheet != null) {
+      sheet.behavior?.removeBottomSheetCallback(sheetCallback)
+      TrueSheetViewPool.release(coordinator, sheet)
+    }
     coordinatorLayout = null
     sheetView = null
+    invalidateScreenMetrics()
 
     interactionState = InteractionState.Idle
     isBeingDismissed = false
+    isPendingStackDismiss = false
     isPresented = false
     isSheetVisible = false
     wasHiddenByScreen = false
@@ -439,6 +478,8 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   // =============================================================================
 
   override fun coordinatorLayoutDidLayout(changed: Boolean) {
+    if (changed) invalidateScreenMetrics()
+
     // Reposition footer when layout changes
     if (isPresented && changed) {
       positionFooter()
@@ -446,6 +487,7 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   }
 
   override fun coordinatorLayoutDidChangeConfiguration() {
+    invalidateScreenMetrics()
     if (!isPresented) return
 
     sheetView?.updateGravity()
@@ -548,7 +590,11 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
 
       BottomSheetBehavior.STATE_EXPANDED,
       BottomSheetBehavior.STATE_COLLAPSED,
-      BottomSheetBehavior.STATE_HALF_EXPANDED -> handleStateSettled(sheetView, newState)
+      BottomSheetBehavior.STATE_HALF_EXPANDED -> {
+        invalidateScreenMetrics()
+        updateScrollExpansionPadding(sheetView.top)
+        handleStateSettled(sheetView, newState)
+      }
 
       else -> {}
     }
@@ -560,24 +606,33 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
 
     val behavior = behavior ?: return
 
-    when (behavior.state) {
-      BottomSheetBehavior.STATE_DRAGGING,
-      BottomSheetBehavior.STATE_SETTLING -> handleDragChange(sheetView)
+    // Every detent query below reads the same layout
+    detentCalculator.beginFrame()
+    try {
+      when (behavior.state) {
+        BottomSheetBehavior.STATE_DRAGGING,
+        BottomSheetBehavior.STATE_SETTLING -> {
+          handleDragChange(sheetView)
+          // Padding relayouts the scrollable; commit it once the sheet settles
+          previewScrollExpansionPadding(sheetView.top)
+        }
 
-      else -> { }
-    }
+        else -> updateScrollExpansionPadding(sheetView.top)
+      }
 
-    updateScrollExpansionPadding(sheetView.top)
-    emitChangePositionDelegate(sheetView.top)
+      emitChangePositionDelegate(sheetView.top)
 
-    // On older APIs, use onSlide for footer positioning during keyboard transitions
-    val useLegacyKeyboardHandling = Build.VERSION.SDK_INT < Build.VERSION_CODES.R
-    if (!isKeyboardTransitioning || useLegacyKeyboardHandling) {
-      positionFooter(slideOffset)
-    }
+      // On older APIs, use onSlide for footer positioning during keyboard transitions
+      val useLegacyKeyboardHandling = Build.VERSION.SDK_INT < Build.VERSION_CODES.R
+      if (!isKeyboardTransitioning || useLegacyKeyboardHandling) {
+        positionFooter(slideOffset)
+      }
 
-    if (!isKeyboardTransitioning) {
-      updateDimAmount(sheetView.top)
+      if (!isKeyboardTransitioning) {
+        updateDimAmount(sheetView.top)
+      }
+    } finally {
+      detentCalculator.endFrame()
     }
   }
 
@@ -590,6 +645,12 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
     containerView?.contentView?.updateScrollExpansionPadding(maxOf(0, sheetTop - expandedOffset))
   }
 
+  private fun previewScrollExpansionPadding(sheetTop: Int) {
+    if (!scrollable) return
+    val expandedOffset = behavior?.expandedOffset ?: return
+    containerView?.contentView?.updateScrollExpansionPadding(maxOf(0, sheetTop - expandedOffset), isSheetMoving = true)
+  }
+
   private fun handleStateSettled(sheetView: View, newState: Int) {
     if (interactionState is InteractionState.Reconfiguring) return
 
@@ -608,6 +669,9 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
       return
     }
 
+    // Drags and resizes end with a settle sample, which positionChangePolicy never drops
+    emitChangePositionDelegate(sheetView.top, realtime = false)
+
     when (interactionState) {
       is InteractionState.Dragging -> {
         val detent = detentCalculator.getDetentValueForIndex(detentInfo.index)
@@ -641,6 +705,13 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
       updateDimAmount(animated = true)
     }
 
+    // With more than 3 detents, recenter the behavior window so the next drag can
+    // reach the detents on either side of the settled one.
+    if (detentCalculator.updateWindow(currentDetentIndex)) {
+      setupSheetDetents(applyState = false)
+      setStateForDetentIndex(currentDetentIndex)
+    }
+
     TrueSheetStackManager.updateBackgroundAccessibility()
   }
 
@@ -774,6 +845,27 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
     coordinator.addView(sheet, params)
   }
 
+  /**
+   * Hides the sheet right away while a sheet above it animates the dismissal of the stack.
+   * Focus events skip it, since it's dismissed without animation once that sheet is gone.
+   */
+  fun hideForStackDismiss() {
+    if (!isPresented || isBeingDismissed) return
+
+    isPendingStackDismiss = true
+    coordinatorLayout?.visibility = INVISIBLE
+  }
+
+  /**
+   * Shows the sheet again when the sheet above it doesn't get dismissed after all.
+   */
+  fun cancelStackDismiss() {
+    if (!isPendingStackDismiss) return
+
+    isPendingStackDismiss = false
+    coordinatorLayout?.visibility = VISIBLE
+  }
+
   fun dismiss(animated: Boolean = true) {
     if (isBeingDismissed) return
 
@@ -822,12 +914,12 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
 
   private fun finishPresent() {
     // Restore isHideable to actual value after present animation
-    behavior?.isHideable = dismissible
+    updateHideable()
 
     containerView?.setupKeyboardHandler()
 
-    val (index, position, detent) = getDetentInfoWithValue(currentDetentIndex)
-    delegate?.viewControllerDidPresent(index, position, detent)
+    val index = getPresentedDetentIndex(currentDetentIndex)
+    delegate?.viewControllerDidPresent(index, getPositionForDetentIndex(index), detentCalculator.getDetentValueForIndex(index))
     parentSheetView?.viewControllerDidBlur()
     delegate?.viewControllerDidFocus()
     sheetView?.updateGrabberAccessibilityValue(index, detents.size)
@@ -857,6 +949,8 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
       return
     }
 
+    TrueSheetMetrics.recordDetentReconfiguration()
+
     containerView?.let {
       cachedContentHeight = it.contentHeight
       cachedHeaderHeight = it.headerHeight
@@ -868,16 +962,28 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
 
     behavior.isFitToContents = false
 
+    // Prefer the pending target while a resize animation is in flight so a
+    // layout-driven reconfigure doesn't revert to the stale currentDetentIndex.
+    val targetIndex = if (pendingDetentIndex >= 0) pendingDetentIndex else currentDetentIndex
+    if (applyState) {
+      detentCalculator.updateWindow(targetIndex)
+    }
+
+    // The behavior's 3 states cover the detents in the current window
+    val windowStart = detentCalculator.windowStart
+    val windowSize = detentCalculator.windowSize
+
     val maxAvailableHeight = realScreenHeight - topInset
 
-    val peekHeight = minOf(detentCalculator.getDetentHeight(detents[0]), maxAvailableHeight)
+    val peekHeight = minOf(detentCalculator.getDetentHeight(detents[windowStart]), maxAvailableHeight)
 
-    val halfExpandedDetentHeight = when (detents.size) {
+    val halfExpandedDetentHeight = when (windowSize) {
       1 -> peekHeight
-      else -> detentCalculator.getDetentHeight(detents[1])
+      else -> detentCalculator.getDetentHeight(detents[windowStart + 1])
     }
 
-    val maxDetentHeight = minOf(detentCalculator.getDetentHeight(detents.last()), maxAvailableHeight)
+    val windowMaxHeight = detentCalculator.getDetentHeight(detents[windowStart + windowSize - 1])
+    val maxDetentHeight = minOf(windowMaxHeight, maxAvailableHeight)
 
     val adjustedHalfExpandedHeight = minOf(halfExpandedDetentHeight, maxAvailableHeight)
     val halfExpandedRatio = (adjustedHalfExpandedHeight.toFloat() / realScreenHeight.toFloat())
@@ -885,7 +991,7 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
     val expandedOffset = realScreenHeight - maxDetentHeight
 
     // fitToContents works better with <= 2 detents when no expanded offset
-    val fitToContents = detents.size < 3 && expandedOffset == 0
+    val fitToContents = windowSize < 3 && expandedOffset == 0
 
     configureDetents(
       behavior = behavior,
@@ -896,12 +1002,15 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
       animate = isPresented
     )
 
-    updateStateDimensions(expandedOffset)
+    // Size the content for the tallest detent, not just the current window
+    val lastDetentHeight = minOf(detentCalculator.getDetentHeight(detents.last()), maxAvailableHeight)
+    updateStateDimensions(realScreenHeight - lastDetentHeight)
+
+    if (isPresented && !isPresentAnimating) {
+      updateHideable()
+    }
 
     if (isPresented && applyState) {
-      // Prefer the pending target while a resize animation is in flight so a
-      // layout-driven reconfigure doesn't revert to the stale currentDetentIndex.
-      val targetIndex = if (pendingDetentIndex >= 0) pendingDetentIndex else currentDetentIndex
       setStateForDetentIndex(targetIndex)
     }
 
@@ -931,9 +1040,21 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   }
 
   fun setStateForDetentIndex(index: Int) {
+    // Detents outside the behavior's current window need it shifted first
+    if (detentCalculator.updateWindow(index)) {
+      setupSheetDetents(applyState = false)
+    }
     behavior?.state = detentCalculator.getStateForDetentIndex(index)
   }
 
+  /**
+   * Only the first detent may be dragged past to dismiss. When the window is shifted
+   * up, collapsing below it must stop at the window's first detent instead.
+   */
+  private fun updateHideable() {
+    behavior?.isHideable = dismissible && detentCalculator.windowStart == 0
+  }
+
   // =============================================================================
   // MARK: - Dimmed Background
   // =============================================================================
@@ -975,7 +1096,7 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
     }
   }
 
-  fun updateDimAmount(sheetTop: Int? = null, animated: Boolean = false) {
+  fun updateDimAmount(sheetTop: Int = UNKNOWN_SHEET_TOP, animated: Boolean = false) {
     if (!dimmed) return
     if (contentHeight == 0) return
 
@@ -984,18 +1105,24 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
       detentCalculator.getSheetTopForDetentIndex(currentDetentIndex)
     } else {
       val keyboardOffset = if (isBeingDismissed) 0 else currentKeyboardInset
-      (sheetTop ?: sheetView?.top ?: return) + keyboardOffset
+      val baseTop = if (sheetTop != UNKNOWN_SHEET_TOP) sheetTop else sheetView?.top ?: return
+      baseTop + keyboardOffset
+    }
+
+    val dimmedDetentTop = detentCalculator.getSheetTopForDetentIndex(dimmedDetentIndex)
+    val belowDimmedTop = if (dimmedDetentIndex > 0) {
+      detentCalculator.getSheetTopForDetentIndex(dimmedDetentIndex - 1)
+    } else {
+      realScreenHeight
     }
+    val alpha = TrueSheetDimView.calculateAlpha(top, dimmedDetentTop, belowDimmedTop)
 
     if (animated) {
-      val targetAlpha = dimView?.calculateAlpha(
-        top,
-        dimmedDetentIndex,
-        detentCalculator::getSheetTopForDetentIndex
-      ) ?: 0f
-      dimViews.forEach { it.animate().alpha(targetAlpha).setDuration(200).start() }
+      dimView?.animate()?.alpha(alpha)?.setDuration(200)?.start()
+      parentDimView?.animate()?.alpha(alpha)?.setDuration(200)?.start()
     } else {
-      dimViews.forEach { it.interpolateAlpha(top, dimmedDetentIndex, detentCalculator::getSheetTopForDetentIndex) }
+      dimView?.alpha = alpha
+      parentDimView?.alpha = alpha
     }
   }
 
@@ -1005,7 +1132,7 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
 
   var footerKeyboardOffset: Int = 0
 
-  fun positionFooter(slideOffset: Float? = null) {
+  fun positionFooter(slideOffset: Float = 0f) {
     if (!isPresented) return
     val footerView = containerView?.footerView ?: return
     val sheet = sheetView ?: return
@@ -1018,7 +1145,7 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
     var footerY = (sheetHeight - sheetTop - footerHeight - keyboardShift).toFloat()
 
     // Adjust during dismiss animation when slideOffset is negative
-    if (slideOffset != null && slideOffset < 0) {
+    if (slideOffset < 0) {
       footerY -= (footerHeight * slideOffset)
     }
 
@@ -1155,6 +1282,7 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
 
   private fun handleSettling(sheetView: View) {
     if (interactionState !is InteractionState.Dragging) return
+    emitWillSettle(sheetView)
     if (keyboardInset <= 0) return
 
     // After drag release, check if the sheet was dragged past the midpoint between the
@@ -1185,6 +1313,31 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
     }
   }
 
+  /**
+   * The behavior doesn't expose where a released drag settles, so its release decision is
+   * replayed from the same offsets and clamped release velocities.
+   */
+  private fun emitWillSettle(sheetView: View) {
+    val behavior = behavior ?: return
+    val offsets = behavior.getSettleOffsets(sheetView) ?: return
+
+    val state = TrueSheetSettlePredictor.predictState(
+      top = sheetView.top,
+      xVelocity = behavior.releaseVelocityX,
+      yVelocity = behavior.releaseVelocity,
+      offsets = offsets,
+      fitToContents = behavior.isFitToContents,
+      hideable = behavior.isHideable,
+      significantVelocity = behavior.significantVelocityThreshold
+    )
+    val index = detentCalculator.getDetentIndexForState(state) ?: -1
+    val targetTop = if (index >= 0) detentCalculator.getSheetTopForDetentIndex(index) else realScreenHeight
+    val position = detentCalculator.getPositionDp(detentCalculator.getVisibleSheetHeight(targetTop))
+    val detent = if (index >= 0) detentCalculator.getDetentValueForIndex(index) else 0f
+    val duration = behavior.estimateSettleDuration(sheetView, targetTop)
+    delegate?.viewControllerWillSettle(index, position, detent, duration)
+  }
+
   private fun handleDragChange(sheetView: View) {
     if (interactionState !is InteractionState.Dragging) return
 
@@ -1198,16 +1351,21 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   // =============================================================================
 
   private fun emitWillPresentEvents() {
-    val (index, position, detent) = getDetentInfoWithValue(currentDetentIndex)
+    val index = getPresentedDetentIndex(currentDetentIndex)
     parentSheetView?.viewControllerWillBlur()
-    delegate?.viewControllerWillPresent(index, position, detent)
+    delegate?.viewControllerWillPresent(index, getPositionForDetentIndex(index), detentCalculator.getDetentValueForIndex(index))
     delegate?.viewControllerWillFocus()
   }
 
   private fun emitWillDismissEvents() {
     delegate?.viewControllerWillBlur()
     delegate?.viewControllerWillDismiss()
-    parentSheetView?.viewControllerWillFocus()
+
+    // A parent dismissed in the same stack dismissal never regains focus
+    val parent = parentSheetView
+    if (parent != null && !parent.viewController.isPendingStackDismiss) {
+      parent.viewControllerWillFocus()
+    }
   }
 
   private fun emitDidDismissEvents() {
@@ -1222,12 +1380,12 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
   }
 
   private fun emitChangePositionDelegate(currentTop: Int, realtime: Boolean = true) {
-    // Dedupe emissions for same position
-    if (currentTop == lastEmittedPositionPx) return
+    // Dedupe emissions for same position. Settle positions are authoritative and always emitted.
+    if (realtime && currentTop == lastEmittedPositionPx) return
 
-    lastEmittedPositionPx = currentTop
     val visibleHeight = realScreenHeight - currentTop
     val position = detentCalculator.getPositionDp(visibleHeight)
+    lastEmittedPositionPx = currentTop
     val interpolatedIndex = detentCalculator.getInterpolatedIndexForPosition(currentTop)
     val detent = detentCalculator.getInterpolatedDetentForPosition(currentTop)
     delegate?.viewControllerDidChangePosition(interpolatedIndex, position, detent, realtime)
@@ -1237,7 +1395,7 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
    * Updates position emission, footer, and dim amount together.
    * This pattern is commonly used during animations and state changes.
    */
-  private fun updateSheetVisuals(effectiveTop: Int, slideOffset: Float? = null) {
+  private fun updateSheetVisuals(effectiveTop: Int, slideOffset: Float = 0f) {
     emitChangePositionDelegate(effectiveTop)
     positionFooter(slideOffset)
     updateDimAmount(effectiveTop)
@@ -1285,12 +1443,12 @@ class TrueSheetViewController(private val reactContext: ThemedReactContext) :
       .start()
   }
 
-  private fun getDetentInfoWithValue(index: Int): Triple<Int, Float, Float> {
+  /**
+   * Detent index the behavior actually presents for [index], after mapping through its state.
+   */
+  private fun getPresentedDetentIndex(index: Int): Int {
     val state = detentCalculator.getStateForDetentIndex(index)
-    val detentIndex = detentCalculator.getDetentIndexForState(state) ?: 0
-    val position = getPositionForDetentIndex(detentIndex)
-    val detent = detentCalculator.getDetentValueForIndex(detentIndex)
-    return Triple(detentIndex, position, detent)
+    return detentCalculator.getDetentIndexForState(state) ?: 0
   }
 
   private fun getPositionForDetentIndex(index: Int): Float {
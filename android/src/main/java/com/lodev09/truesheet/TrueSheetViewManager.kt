@@ -85,12 +85,14 @@ class TrueSheetViewManager :
       DragBeginEvent.EVENT_NAME to hashMapOf("registrationName" to DragBeginEvent.REGISTRATION_NAME),
       DragChangeEvent.EVENT_NAME to hashMapOf("registrationName" to DragChangeEvent.REGISTRATION_NAME),
       DragEndEvent.EVENT_NAME to hashMapOf("registrationName" to DragEndEvent.REGISTRATION_NAME),
+      WillSettleEvent.EVENT_NAME to hashMapOf("registrationName" to WillSettleEvent.REGISTRATION_NAME),
       PositionChangeEvent.EVENT_NAME to hashMapOf("registrationName" to PositionChangeEvent.REGISTRATION_NAME),
       WillFocusEvent.EVENT_NAME to hashMapOf("registrationName" to WillFocusEvent.REGISTRATION_NAME),
       FocusEvent.EVENT_NAME to hashMapOf("registrationName" to FocusEvent.REGISTRATION_NAME),
       WillBlurEvent.EVENT_NAME to hashMapOf("registrationName" to WillBlurEvent.REGISTRATION_NAME),
       BlurEvent.EVENT_NAME to hashMapOf("registrationName" to BlurEvent.REGISTRATION_NAME),
-      VisibilityChangeEvent.EVENT_NAME to hashMapOf("registrationName" to VisibilityChangeEvent.REGISTRATION_NAME)
+      VisibilityChangeEvent.EVENT_NAME to hashMapOf("registrationName" to VisibilityChangeEvent.REGISTRATION_NAME),
+      CommandCompleteEvent.EVENT_NAME to hashMapOf("registrationName" to CommandCompleteEvent.REGISTRATION_NAME)
     )
 
   // ==================== Props ====================
@@ -272,6 +274,22 @@ class TrueSheetViewManager :
     view.setFooterKeyboardOffset(keyboardOffset)
   }
 
+  @ReactProp(name = "presentRequest")
+  override fun setPresentRequest(view: TrueSheetView, request: ReadableMap?) {
+    val index = if (request != null && request.hasKey("index")) request.getInt("index") else -1
+    val animated = request == null || !request.hasKey("animated") || request.getBoolean("animated")
+    val requestId = if (request != null && request.hasKey("id")) request.getInt("id") else 0
+    view.setPresentRequest(index, animated, requestId)
+  }
+
+  @ReactProp(name = "positionChangePolicy")
+  override fun setPositionChangePolicy(view: TrueSheetView, policy: ReadableMap?) {
+    val settledOnly = policy != null && policy.hasKey("settledOnly") && policy.getBoolean("settledOnly")
+    val maxHz = if (policy != null && policy.hasKey("maxHz")) policy.getDouble("maxHz") else 0.0
+    val minDelta = if (policy != null && policy.hasKey("minDelta")) policy.getDouble("minDelta") else 0.0
+    view.setPositionChangePolicy(settledOnly, maxHz, minDelta)
+  }
+
   companion object {
     const val REACT_CLASS = "TrueSheetView"
     const val TAG_NAME = "TrueSheet"
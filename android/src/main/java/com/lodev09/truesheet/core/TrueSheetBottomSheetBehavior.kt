@@ -1,12 +1,106 @@
 package com.lodev09.truesheet.core
 
+import android.view.MotionEvent
+import android.view.VelocityTracker
 import android.view.View
+import android.view.ViewConfiguration
 import androidx.coordinatorlayout.widget.CoordinatorLayout
 import com.google.android.material.bottomsheet.BottomSheetBehavior
+import kotlin.math.PI
+import kotlin.math.abs
+import kotlin.math.min
+import kotlin.math.roundToInt
+import kotlin.math.sin
 
 class TrueSheetBottomSheetBehavior<V : View> : BottomSheetBehavior<V>() {
   var scrollingExpandsSheet: Boolean = true
 
+  private var velocityTracker: VelocityTracker? = null
+
+  /**
+   * Vertical velocity of the last touch stream in px/s, positive when moving down.
+   * Computed on release, before the behavior starts settling.
+   */
+  var releaseVelocity: Float = 0f
+    private set
+
+  /**
+   * Horizontal velocity of the last touch stream in px/s.
+   */
+  var releaseVelocityX: Float = 0f
+    private set
+
+  /**
+   * Fed every touch of the hosting layout, including streams a nested scrollable has claimed.
+   * Material's own velocity tracker isn't exposed, so the release velocity is tracked here and
+   * clamped the way ViewDragHelper clamps the velocity it hands to `onViewReleased`.
+   */
+  fun trackTouchEvent(event: MotionEvent, minVelocity: Float, maxVelocity: Float) {
+    if (event.actionMasked == MotionEvent.ACTION_DOWN) {
+      velocityTracker?.clear()
+      releaseVelocity = 0f
+      releaseVelocityX = 0f
+    }
+
+    val tracker = velocityTracker ?: VelocityTracker.obtain().also { velocityTracker = it }
+    tracker.addMovement(event)
+
+    if (event.actionMasked == MotionEvent.ACTION_UP || event.actionMasked == MotionEvent.ACTION_CANCEL) {
+      tracker.computeCurrentVelocity(1000, maxVelocity)
+      releaseVelocity = clampVelocity(tracker.yVelocity, minVelocity)
+      releaseVelocityX = clampVelocity(tracker.xVelocity, minVelocity)
+    }
+  }
+
+  private fun clampVelocity(velocity: Float, minVelocity: Float): Float = if (abs(velocity) < minVelocity) 0f else velocity
+
+  /**
+   * Offsets Material settles a released drag between, derived the way it computes them.
+   */
+  fun getSettleOffsets(child: View): TrueSheetSettleOffsets? {
+    val parentHeight = (child.parent as? View)?.height ?: return null
+    val fitToContentsOffset = maxOf(0, parentHeight - child.height)
+    val collapsedOffset = if (isFitToContents) {
+      maxOf(parentHeight - peekHeight, fitToContentsOffset)
+    } else {
+      parentHeight - peekHeight
+    }
+
+    return TrueSheetSettleOffsets(
+      parentHeight = parentHeight,
+      expandedOffset = expandedOffset,
+      halfExpandedOffset = (parentHeight * (1 - halfExpandedRatio)).toInt(),
+      collapsedOffset = collapsedOffset,
+      peekHeight = peekHeight
+    )
+  }
+
+  /**
+   * Estimated time in ms for the released [child] to settle at [targetTop].
+   * Mirrors ViewDragHelper's settle duration for the release velocity.
+   */
+  fun estimateSettleDuration(child: View, targetTop: Int): Int {
+    val parent = child.parent as? View ?: return 0
+    val distance = abs(targetTop - child.top)
+    if (distance == 0 || parent.width == 0) return 0
+
+    val config = ViewConfiguration.get(child.context)
+    val velocity = abs(releaseVelocity).let {
+      if (it < config.scaledMinimumFlingVelocity) 0f else min(it, config.scaledMaximumFlingVelocity.toFloat())
+    }
+
+    val duration = if (velocity > 0) {
+      val halfWidth = parent.width / 2f
+      val distanceRatio = min(1f, distance.toFloat() / parent.width)
+      val influence = sin((distanceRatio - 0.5f) * 0.3f * PI.toFloat() / 2f)
+      4 * (1000 * (halfWidth + halfWidth * influence) / velocity).roundToInt()
+    } else {
+      val motionRange = if (isHideable) parent.height else parent.height - peekHeight
+      ((distance.toFloat() / maxOf(1, motionRange) + 1) * BASE_SETTLE_DURATION).toInt()
+    }
+    return min(duration, MAX_SETTLE_DURATION)
+  }
+
   override fun onNestedPreScroll(
     coordinatorLayout: CoordinatorLayout,
     child: V,
@@ -33,4 +127,10 @@ class TrueSheetBottomSheetBehavior<V : View> : BottomSheetBehavior<V>() {
     if (!scrollingExpandsSheet) return false
     return super.onNestedPreFling(coordinatorLayout, child, target, velocityX, velocityY)
   }
+
+  companion object {
+    // ViewDragHelper's settle durations
+    private const val BASE_SETTLE_DURATION = 256
+    private const val MAX_SETTLE_DURATION = 600
+  }
 }
@@ -11,6 +11,7 @@ import android.view.GestureDetector
 import android.view.Gravity
 import android.view.MotionEvent
 import android.view.View
+import android.view.ViewGroup
 import android.view.ViewOutlineProvider
 import android.widget.FrameLayout
 import androidx.coordinatorlayout.widget.CoordinatorLayout
@@ -81,6 +82,19 @@ class TrueSheetBottomSheetView(private val reactContext: ThemedReactContext) : F
     clipToPadding = false
   }
 
+  /**
+   * Resets the view so [TrueSheetViewPool] can hand it to another sheet.
+   */
+  fun recycle() {
+    delegate = null
+    animate().cancel()
+    (parent as? ViewGroup)?.removeView(this)
+    removeAllViews()
+    super.setTranslationY(0f)
+    background = null
+    elevation = 0f
+  }
+
   override fun setTranslationY(translationY: Float) {
     // This prevents keyboard inset animations from resetting parent sheet translation
     if (translationY == 0f && this.translationY != 0f) {
@@ -35,6 +35,8 @@ class TrueSheetCoordinatorLayout(context: Context) :
   var delegate: TrueSheetCoordinatorLayoutDelegate? = null
 
   private val touchSlop: Int = ViewConfiguration.get(context).scaledTouchSlop
+  private val minFlingVelocity: Float = ViewConfiguration.get(context).scaledMinimumFlingVelocity.toFloat()
+  private val maxFlingVelocity: Float = ViewConfiguration.get(context).scaledMaximumFlingVelocity.toFloat()
   private var dragging = false
   private var initialY = 0f
   private var activePointerId = 0
@@ -75,6 +77,17 @@ class TrueSheetCoordinatorLayout(context: Context) :
     clipToPadding = false
   }
 
+  /**
+   * Resets the layout so [TrueSheetViewPool] can hand it to another sheet.
+   */
+  fun recycle() {
+    delegate = null
+    removeAllViews()
+    visibility = VISIBLE
+    dragging = false
+    streamGestureClaimed = false
+  }
+
   override fun onLayout(
     changed: Boolean,
     l: Int,
@@ -173,6 +186,15 @@ class TrueSheetCoordinatorLayout(context: Context) :
     streamGestureClaimed = true
   }
 
+  /**
+   * Every touch passes here once, even when a child disallows interception,
+   * so the behavior sees the whole stream when estimating the release velocity.
+   */
+  override fun dispatchTouchEvent(ev: MotionEvent): Boolean {
+    delegate?.findSheetView()?.behavior?.trackTouchEvent(ev, minFlingVelocity, maxFlingVelocity)
+    return super.dispatchTouchEvent(ev)
+  }
+
   /**
    * Intercepts touch events for ScrollViews that can't scroll (content < viewport),
    * allowing the sheet to be dragged in these cases.
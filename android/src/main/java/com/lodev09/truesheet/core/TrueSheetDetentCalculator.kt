@@ -25,68 +25,107 @@ interface TrueSheetDetentCalculatorDelegate {
 
 /**
  * Handles all detent-related calculations for the bottom sheet.
+ * Backed by the shared C++ [TrueSheetDetentEngine]. Delegate values are only pushed to the
+ * engine when they change, and at most once per frame while a frame is open.
  */
 class TrueSheetDetentCalculator(private val reactContext: ThemedReactContext) {
 
   var delegate: TrueSheetDetentCalculatorDelegate? = null
 
+  private val engine = TrueSheetDetentEngine()
+  private var syncedDetents: List<Double>? = null
+
+  // Layout last pushed to the engine, in setLayout argument order
+  private val layout = DoubleArray(LAYOUT_SIZE)
+  private val syncedLayout = DoubleArray(LAYOUT_SIZE) { Double.NaN }
+  private var isFrameSynced = false
+
   private val screenHeight: Int get() = delegate?.screenHeight ?: 0
   private val realScreenHeight: Int get() = delegate?.realScreenHeight ?: 0
   private val detents: List<Double> get() = delegate?.detents ?: emptyList()
-  private val contentHeight: Int get() = delegate?.contentHeight ?: 0
-  private val headerHeight: Int get() = delegate?.headerHeight ?: 0
-  private val footerHeight: Int get() = delegate?.footerHeight ?: 0
-  private val peekContentHeight: Int get() = delegate?.peekContentHeight ?: 0
-  private val contentBottomInset: Int get() = delegate?.contentBottomInset ?: 0
-  private val maxContentHeight: Int? get() = delegate?.maxContentHeight
-  private val keyboardInset: Int get() = delegate?.keyboardInset ?: 0
-  private val topInset: Int get() = delegate?.topInset ?: 0
 
   /**
-   * Height for peek (-2.0) detents: header + footer + peek content height.
-   * Falls back to 150dp when none is present.
+   * Syncs the engine once for every query made until [endFrame], e.g. from one slide callback.
+   * The delegate's measurements can't change mid-frame, so they aren't compared per query.
+   */
+  fun beginFrame() {
+    syncEngine()
+    isFrameSynced = true
+  }
+
+  fun endFrame() {
+    isFrameSynced = false
+  }
+
+  /**
+   * Pushes the delegate's current measurements into the engine.
+   * Detents are only re-read when the delegate hands out a different list, and the layout only
+   * crosses into the engine when one of its values changed.
    */
-  private val peekDetentHeight: Int
-    get() {
-      val height = headerHeight + footerHeight + peekContentHeight
-      return if (height > 0) height else DEFAULT_PEEK_HEIGHT.dpToPx().toInt()
+  private fun syncEngine() {
+    if (isFrameSynced) return
+
+    val delegate = delegate
+    val detents = detents
+    if (detents !== syncedDetents) {
+      syncedDetents = detents
+      engine.setDetents(detents.toDoubleArray())
     }
 
+    layout[0] = screenHeight.toDouble()
+    layout[1] = realScreenHeight.toDouble()
+    layout[2] = (delegate?.contentHeight ?: 0).toDouble()
+    layout[3] = (delegate?.headerHeight ?: 0).toDouble()
+    layout[4] = (delegate?.footerHeight ?: 0).toDouble()
+    layout[5] = (delegate?.peekContentHeight ?: 0).toDouble()
+    layout[6] = DEFAULT_PEEK_HEIGHT.dpToPx().toInt().toDouble()
+    layout[7] = (delegate?.contentBottomInset ?: 0).toDouble()
+    layout[8] = (delegate?.keyboardInset ?: 0).toDouble()
+    layout[9] = (delegate?.topInset ?: 0).toDouble()
+    layout[10] = (delegate?.maxContentHeight ?: 0).toDouble()
+    if (layout.contentEquals(syncedLayout)) return
+    layout.copyInto(syncedLayout)
+
+    engine.setLayout(
+      screenHeight = layout[0],
+      containerHeight = layout[1],
+      contentHeight = layout[2],
+      headerHeight = layout[3],
+      footerHeight = layout[4],
+      peekContentHeight = layout[5],
+      peekFallbackHeight = layout[6],
+      bottomInset = layout[7],
+      keyboardInset = layout[8],
+      topInset = layout[9],
+      maxContentHeight = layout[10]
+    )
+  }
+
   /**
    * Calculate the height in pixels for a given detent value.
    * @param detent The detent value: -1.0 for content-fit, -2.0 for peek, or 0.0-1.0 for screen fraction
    */
   fun getDetentHeight(detent: Double, includeKeyboard: Boolean = true): Int {
-    val baseHeight = if (detent == -1.0) {
-      contentHeight + headerHeight + contentBottomInset
-    } else if (detent == -2.0) {
-      peekDetentHeight + contentBottomInset
-    } else {
-      if (detent <= 0.0 || detent > 1.0) {
-        throw IllegalArgumentException("TrueSheet: detent fraction ($detent) must be between 0 and 1")
-      }
-      (detent * screenHeight).toInt() + contentBottomInset
+    if (detent != -1.0 && detent != -2.0 && (detent <= 0.0 || detent > 1.0)) {
+      throw IllegalArgumentException("TrueSheet: detent fraction ($detent) must be between 0 and 1")
     }
 
-    val height = if (includeKeyboard) baseHeight + keyboardInset else baseHeight
-    val maxAllowedHeight = screenHeight + contentBottomInset
-    return maxContentHeight?.let { minOf(height, it, maxAllowedHeight) } ?: minOf(height, maxAllowedHeight)
+    syncEngine()
+    return engine.getDetentHeight(detent, includeKeyboard).toInt()
   }
 
   /**
    * Get the expected sheet top position for a detent index.
+   * Clamped to the space the sheet can actually occupy — matching setupSheetDetents.
    */
   fun getSheetTopForDetentIndex(index: Int): Int {
     if (index < 0 || index >= detents.size) {
       RNLog.w(reactContext, "TrueSheet: Detent index ($index) is out of bounds (0..${detents.size - 1})")
       return realScreenHeight
     }
-    // Clamp to the space the sheet can actually occupy — matching
-    // setupSheetDetents. A keyboard-inflated detent height can exceed it,
-    // placing the expected top above the screen while the real sheet stops
-    // at the top inset.
-    val maxAvailableHeight = realScreenHeight - topInset
-    return realScreenHeight - minOf(getDetentHeight(detents[index]), maxAvailableHeight)
+
+    syncEngine()
+    return realScreenHeight - engine.getResolvedHeight(index).toInt()
   }
 
   /**
@@ -103,15 +142,8 @@ class TrueSheetDetentCalculator(private val reactContext: ThemedReactContext) {
    * Returns the raw screen fraction for a detent index (without bottomInset).
    */
   fun getDetentValueForIndex(index: Int): Float {
-    if (index < 0 || index >= detents.size) return 0f
-    val value = detents[index]
-    return if (value == -1.0) {
-      (contentHeight + headerHeight).toFloat() / screenHeight.toFloat()
-    } else if (value == -2.0) {
-      peekDetentHeight.toFloat() / screenHeight.toFloat()
-    } else {
-      value.toFloat()
-    }
+    syncEngine()
+    return engine.getDetentValue(index).toFloat()
   }
 
   // ====================================================================
@@ -119,46 +151,60 @@ class TrueSheetDetentCalculator(private val reactContext: ThemedReactContext) {
   // ====================================================================
 
   /**
-   * Maps detent index to BottomSheetBehavior state based on detent count.
+   * First detent index mapped onto BottomSheetBehavior's collapsed state.
+   * The behavior only has 3 resting states, so with more detents it covers a sliding
+   * window of 3 adjacent detents that is moved with [updateWindow].
    */
-  fun getStateForDetentIndex(index: Int): Int {
-    val stateMap = getDetentStateMap() ?: return BottomSheetBehavior.STATE_HIDDEN
-    return stateMap.entries.find { it.value == index }?.key ?: BottomSheetBehavior.STATE_HIDDEN
+  var windowStart: Int = 0
+    private set
+
+  /**
+   * Number of detents the behavior currently covers (at most 3).
+   */
+  val windowSize: Int get() = minOf(detents.size, MAX_BEHAVIOR_DETENTS)
+
+  /**
+   * Moves the window so the detent at [index] has a neighbour on each side where possible.
+   * @return true if the window moved and the behavior needs to be reconfigured
+   */
+  fun updateWindow(index: Int): Boolean {
+    val maxStart = maxOf(0, detents.size - MAX_BEHAVIOR_DETENTS)
+    val start = (index - 1).coerceIn(0, maxStart)
+    if (start == windowStart) return false
+
+    windowStart = start
+    return true
   }
 
   /**
-   * Maps BottomSheetBehavior state to detent index.
-   * @return The detent index, or null if state is not mapped
+   * Maps detent index to BottomSheetBehavior state within the current window.
    */
-  fun getDetentIndexForState(state: Int): Int? {
-    val stateMap = getDetentStateMap() ?: return null
-    return stateMap[state]
+  fun getStateForDetentIndex(index: Int): Int {
+    val slot = index - windowStart
+    if (slot < 0 || slot >= windowSize) return BottomSheetBehavior.STATE_HIDDEN
+
+    return when (slot) {
+      0 -> BottomSheetBehavior.STATE_COLLAPSED
+      1 -> BottomSheetBehavior.STATE_HALF_EXPANDED
+      else -> BottomSheetBehavior.STATE_EXPANDED
+    }
   }
 
   /**
-   * Returns state-to-index mapping based on detent count.
+   * Maps BottomSheetBehavior state to detent index.
+   * @return The detent index, or null if state is not mapped
    */
-  private fun getDetentStateMap(): Map<Int, Int>? =
-    when (detents.size) {
-      1 -> mapOf(
-        BottomSheetBehavior.STATE_COLLAPSED to 0,
-        BottomSheetBehavior.STATE_EXPANDED to 0
-      )
-
-      2 -> mapOf(
-        BottomSheetBehavior.STATE_COLLAPSED to 0,
-        BottomSheetBehavior.STATE_HALF_EXPANDED to 1,
-        BottomSheetBehavior.STATE_EXPANDED to 1
-      )
-
-      3 -> mapOf(
-        BottomSheetBehavior.STATE_COLLAPSED to 0,
-        BottomSheetBehavior.STATE_HALF_EXPANDED to 1,
-        BottomSheetBehavior.STATE_EXPANDED to 2
-      )
-
-      else -> null
+  fun getDetentIndexForState(state: Int): Int? {
+    val size = windowSize
+    val slot = when (state) {
+      BottomSheetBehavior.STATE_COLLAPSED -> 0
+      BottomSheetBehavior.STATE_HALF_EXPANDED -> if (size > 1) 1 else return null
+      BottomSheetBehavior.STATE_EXPANDED -> size - 1
+      else -> return null
     }
+    if (size == 0) return null
+    return windowStart + slot
+  }
 
   // ====================================================================
   // MARK: - Interpolation
@@ -166,83 +212,38 @@ class TrueSheetDetentCalculator(private val reactContext: ThemedReactContext) {
 
   /**
    * Find which segment the position falls into for interpolation.
-   * @return Triple(fromIndex, toIndex, progress) where progress is 0-1, or null if no detents
+   * Writes [fromIndex, toIndex, progress] into [out], where progress is 0-1.
+   * @return false if there are no detents
    */
-  fun findSegmentForPosition(positionPx: Int): Triple<Int, Int, Float>? {
-    val count = detents.size
-    if (count == 0) return null
-
-    val firstPos = getSheetTopForDetentIndex(0)
-
-    // Position is below first detent (sheet is being dragged down to dismiss)
-    if (positionPx > firstPos) {
-      val range = realScreenHeight - firstPos
-      val progress = if (range > 0) (positionPx - firstPos).toFloat() / range else 0f
-      return Triple(-1, 0, progress)
-    }
-
-    if (count == 1) return Triple(0, 0, 0f)
-
-    val lastPos = getSheetTopForDetentIndex(count - 1)
-    // Position is above last detent
-    if (positionPx < lastPos) {
-      return Triple(count - 1, count - 1, 0f)
-    }
+  fun findSegmentForPosition(positionPx: Int, out: DoubleArray): Boolean {
+    if (detents.isEmpty()) return false
 
-    // Find the segment containing this position
-    for (i in 0 until count - 1) {
-      val pos = getSheetTopForDetentIndex(i)
-      val nextPos = getSheetTopForDetentIndex(i + 1)
-
-      // Skip degenerate segments — keyboard growth can clamp adjacent detents
-      // to the same top; falling through reports the topmost detent
-      if (pos == nextPos) continue
-
-      if (positionPx in nextPos..pos) {
-        val range = pos - nextPos
-        val progress = if (range > 0) (pos - positionPx).toFloat() / range else 0f
-        return Triple(i, i + 1, maxOf(0f, minOf(1f, progress)))
-      }
-    }
-
-    return Triple(count - 1, count - 1, 0f)
+    syncEngine()
+    engine.findSegment(getVisibleSheetHeight(positionPx).toDouble(), out)
+    return true
   }
 
   /**
    * Returns continuous index (e.g., 0.5 = halfway between detent 0 and 1).
    */
   fun getInterpolatedIndexForPosition(positionPx: Int): Float {
-    val count = detents.size
-    if (count == 0) return -1f
-
-    val segment = findSegmentForPosition(positionPx) ?: return 0f
-    val (fromIndex, _, progress) = segment
-
-    if (fromIndex == -1) return -progress
-    return fromIndex + progress
+    syncEngine()
+    return engine.getInterpolatedIndex(getVisibleSheetHeight(positionPx).toDouble()).toFloat()
   }
 
   /**
    * Returns interpolated screen fraction for position.
    */
   fun getInterpolatedDetentForPosition(positionPx: Int): Float {
-    val count = detents.size
-    if (count == 0) return 0f
-
-    val segment = findSegmentForPosition(positionPx) ?: return getDetentValueForIndex(0)
-    val (fromIndex, toIndex, progress) = segment
-
-    if (fromIndex == -1) {
-      val firstDetent = getDetentValueForIndex(0)
-      return maxOf(0f, firstDetent * (1 - progress))
-    }
-
-    val fromDetent = getDetentValueForIndex(fromIndex)
-    val toDetent = getDetentValueForIndex(toIndex)
-    return fromDetent + progress * (toDetent - fromDetent)
+    syncEngine()
+    return engine.getInterpolatedDetent(getVisibleSheetHeight(positionPx).toDouble()).toFloat()
   }
 
   companion object {
     private const val DEFAULT_PEEK_HEIGHT = 150f
+    private const val LAYOUT_SIZE = 11
+
+    // Collapsed, half-expanded and expanded
+    private const val MAX_BEHAVIOR_DETENTS = 3
   }
 }
@@ -0,0 +1,57 @@
+package com.lodev09.truesheet.core
+
+import com.facebook.jni.HybridData
+import com.facebook.proguard.annotations.DoNotStrip
+import com.facebook.soloader.SoLoader
+
+/**
+ * JNI binding for the shared C++ detent engine in `common/cpp`.
+ * Detents and measurements are pushed in once; lookups run natively without allocating.
+ */
+@DoNotStrip
+class TrueSheetDetentEngine {
+
+  @DoNotStrip
+  @Suppress("unused")
+  private val mHybridData: HybridData = initHybrid()
+
+  external fun setDetents(detents: DoubleArray)
+
+  external fun setLayout(
+    screenHeight: Double,
+    containerHeight: Double,
+    contentHeight: Double,
+    headerHeight: Double,
+    footerHeight: Double,
+    peekContentHeight: Double,
+    peekFallbackHeight: Double,
+    bottomInset: Double,
+    keyboardInset: Double,
+    topInset: Double,
+    maxContentHeight: Double
+  )
+
+  external fun getDetentValue(index: Int): Double
+
+  external fun getDetentHeight(detent: Double, includeKeyboard: Boolean): Double
+
+  external fun getResolvedHeight(index: Int): Double
+
+  /**
+   * Writes `[fromIndex, toIndex, progress]` for the given sheet height into [out].
+   */
+  external fun findSegment(sheetHeight: Double, out: DoubleArray)
+
+  external fun getInterpolatedIndex(sheetHeight: Double): Double
+
+  external fun getInterpolatedDetent(sheetHeight: Double): Double
+
+  private companion object {
+    init {
+      SoLoader.loadLibrary("react_codegen_TrueSheetSpec")
+    }
+
+    @JvmStatic
+    external fun initHybrid(): HybridData
+  }
+}
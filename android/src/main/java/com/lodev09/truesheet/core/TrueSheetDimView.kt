@@ -10,7 +10,6 @@ import android.view.ViewOutlineProvider
 import com.facebook.react.uimanager.PointerEvents
 import com.facebook.react.uimanager.ReactPointerEventsView
 import com.facebook.react.uimanager.ThemedReactContext
-import com.lodev09.truesheet.utils.ScreenUtils
 
 /**
  * Delegate for handling dim view interactions.
@@ -36,6 +35,22 @@ class TrueSheetDimView(private val reactContext: ThemedReactContext) :
 
   companion object {
     private const val MAX_ALPHA = 0.5f
+
+    /**
+     * Alpha for a sheet at [sheetTop], fading in between the detent below the dimmed one
+     * ([belowDimmedTop]) and the dimmed detent ([dimmedDetentTop]).
+     */
+    fun calculateAlpha(sheetTop: Int, dimmedDetentTop: Int, belowDimmedTop: Int): Float =
+      when {
+        sheetTop <= dimmedDetentTop -> MAX_ALPHA
+
+        sheetTop >= belowDimmedTop -> 0f
+
+        else -> {
+          val progress = 1f - (sheetTop - dimmedDetentTop).toFloat() / (belowDimmedTop - dimmedDetentTop)
+          (progress * MAX_ALPHA).coerceIn(0f, MAX_ALPHA)
+        }
+      }
   }
 
   var delegate: TrueSheetDimViewDelegate? = null
@@ -108,31 +123,6 @@ class TrueSheetDimView(private val reactContext: ThemedReactContext) :
     targetView = null
   }
 
-  // =============================================================================
-  // MARK: - Alpha Calculation
-  // =============================================================================
-
-  fun calculateAlpha(sheetTop: Int, dimmedDetentIndex: Int, getSheetTopForDetentIndex: (Int) -> Int): Float {
-    val realHeight = ScreenUtils.getRealScreenHeight(reactContext)
-    val dimmedDetentTop = getSheetTopForDetentIndex(dimmedDetentIndex)
-    val belowDimmedTop = if (dimmedDetentIndex > 0) getSheetTopForDetentIndex(dimmedDetentIndex - 1) else realHeight
-
-    return when {
-      sheetTop <= dimmedDetentTop -> MAX_ALPHA
-
-      sheetTop >= belowDimmedTop -> 0f
-
-      else -> {
-        val progress = 1f - (sheetTop - dimmedDetentTop).toFloat() / (belowDimmedTop - dimmedDetentTop)
-        (progress * MAX_ALPHA).coerceIn(0f, MAX_ALPHA)
-      }
-    }
-  }
-
-  fun interpolateAlpha(sheetTop: Int, dimmedDetentIndex: Int, getSheetTopForDetentIndex: (Int) -> Int) {
-    alpha = calculateAlpha(sheetTop, dimmedDetentIndex, getSheetTopForDetentIndex)
-  }
-
   // =============================================================================
   // MARK: - Touch Handling
   // =============================================================================
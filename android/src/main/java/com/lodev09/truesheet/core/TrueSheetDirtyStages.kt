@@ -0,0 +1,70 @@
+package com.lodev09.truesheet.core
+
+/**
+ * Sheet reconfiguration stages invalidated by prop setters.
+ * Setters only mark their stages when the value actually changes, and the view runs each
+ * dirty stage once when the prop transaction finalizes.
+ */
+class TrueSheetDirtyStages {
+
+  var stages: Int = 0
+    private set
+
+  /**
+   * Applies [value] and marks [stages] dirty, unless it equals [current].
+   */
+  inline fun <T> update(current: T, value: T, stages: Int, apply: (T) -> Unit) {
+    if (current == value) return
+    apply(value)
+    mark(stages)
+  }
+
+  fun mark(stages: Int) {
+    this.stages = this.stages or stages
+  }
+
+  /**
+   * Returns the dirty stages and clears them.
+   */
+  fun take(): Int {
+    val dirty = stages
+    stages = 0
+    return dirty
+  }
+
+  companion object {
+    const val STAGE_SCROLLABLE = 1 shl 0
+    const val STAGE_BACKGROUND = 1 shl 1
+    const val STAGE_ELEVATION = 1 shl 2
+    const val STAGE_GRABBER = 1 shl 3
+    const val STAGE_GRAVITY = 1 shl 4
+    const val STAGE_MAX_WIDTH = 1 shl 5
+    const val STAGE_DETENTS = 1 shl 6
+    const val STAGE_ALL = (1 shl 7) - 1
+  }
+
+  /**
+   * Stages each prop setter marks. Shared with the tests so they check the mapping the view uses.
+   */
+  object PropStages {
+    const val MAX_CONTENT_HEIGHT = STAGE_DETENTS
+    const val MAX_CONTENT_WIDTH = STAGE_MAX_WIDTH
+    const val ANCHOR = STAGE_GRAVITY
+    const val ANCHOR_OFFSET = STAGE_GRAVITY
+    const val CORNER_RADIUS = STAGE_BACKGROUND
+    const val BACKGROUND_COLOR = STAGE_BACKGROUND
+    const val DRAGGABLE = STAGE_GRABBER
+    const val GRABBER = STAGE_GRABBER
+    const val GRABBER_OPTIONS = STAGE_GRABBER
+    const val ACCESSIBILITY_OPTIONS = STAGE_GRABBER
+    const val ELEVATION = STAGE_ELEVATION
+    const val DETENTS = STAGE_DETENTS
+
+    // The inset feeds the bottom inset the detent heights are computed with
+    const val INSET_ADJUSTMENT = STAGE_SCROLLABLE or STAGE_DETENTS
+
+    // Detent heights don't depend on these; the controller refreshes the scroll expansion padding itself
+    const val SCROLLABLE = STAGE_SCROLLABLE
+    const val SCROLLABLE_OPTIONS = STAGE_SCROLLABLE
+  }
+}
@@ -0,0 +1,60 @@
+package com.lodev09.truesheet.core
+
+interface TrueSheetDrainSignalDelegate {
+  fun drainSignalRunOnJSQueue(task: Runnable)
+  fun drainSignalRunOnUiThread(task: Runnable)
+}
+
+/**
+ * Signals the coalescer once JS has worked through the events dispatched so far.
+ *
+ * Fabric queues dispatched events natively and only flushes them to JS when the event beat
+ * ticks on the next frame, right before the dispatcher notifies [onBatchEventDispatched]
+ * listeners. So a drain waits for that notification, then for a task queued on the JS thread
+ * behind the flush it scheduled, then hops back to the UI thread.
+ *
+ * This is best effort: it relies on the flush and the JS queue task running in the order they
+ * were scheduled. If they don't, the drain arrives one flush early and the coalescer dispatches
+ * one extra sample, it never loses one.
+ */
+class TrueSheetDrainSignal {
+
+  var delegate: TrueSheetDrainSignalDelegate? = null
+
+  private var callback: Runnable? = null
+  private var isAwaitingBatch = false
+
+  // Reused for every drain so coalesced dispatch doesn't allocate tasks per sample
+  private val uiTask = Runnable {
+    val callback = callback ?: return@Runnable
+    this.callback = null
+    callback.run()
+  }
+  private val jsTask = Runnable { delegate?.drainSignalRunOnUiThread(uiTask) }
+
+  /**
+   * Runs [callback] on the UI thread after the next event flush reached JS. UI thread only.
+   */
+  fun await(callback: Runnable) {
+    this.callback = callback
+    isAwaitingBatch = true
+  }
+
+  /**
+   * Called on the UI thread after the event beat scheduled the flush of the dispatched events.
+   */
+  fun onBatchEventDispatched() {
+    if (!isAwaitingBatch) return
+
+    isAwaitingBatch = false
+    delegate?.drainSignalRunOnJSQueue(jsTask)
+  }
+
+  /**
+   * Drops a pending drain, e.g. when the view goes away.
+   */
+  fun cancel() {
+    callback = null
+    isAwaitingBatch = false
+  }
+}
@@ -0,0 +1,124 @@
+package com.lodev09.truesheet.core
+
+interface TrueSheetEventCoalescerDelegate {
+  fun coalescerDispatchPositionChange(
+    index: Float,
+    position: Float,
+    detent: Float,
+    realtime: Boolean,
+    sequence: Int,
+    timestamp: Double
+  )
+  fun coalescerDispatchDragChange(index: Int, position: Float, detent: Float, sequence: Int, timestamp: Double)
+
+  /**
+   * A pending position sample was overwritten before it reached JS.
+   */
+  fun coalescerDidDropPositionChange()
+
+  /**
+   * Invoke [callback] on the UI thread once JS has caught up with the events dispatched so far.
+   * Best effort: an early callback only costs one extra dispatched sample.
+   */
+  fun coalescerAwaitDrain(callback: Runnable)
+}
+
+/**
+ * Latest-wins delivery for high-frequency sheet samples (position and drag change).
+ *
+ * Fabric only coalesces an event with the tail of its queue, and position and drag
+ * samples interleave, so a busy JS thread would replay every stale sample. Instead, at most
+ * one sample per kind is handed to the dispatcher until JS drains; newer samples overwrite
+ * the pending one in place. Sequence numbers advance for every sample, so consumers see
+ * dropped samples as gaps.
+ */
+class TrueSheetEventCoalescer {
+
+  var delegate: TrueSheetEventCoalescerDelegate? = null
+
+  private var isAwaitingDrain = false
+  private val drainCallback = Runnable {
+    isAwaitingDrain = false
+    dispatchPending()
+  }
+
+  // Pending position sample
+  private var hasPendingPosition = false
+  private var positionIndex = 0f
+  private var position = 0f
+  private var positionDetent = 0f
+  private var positionRealtime = false
+  private var positionTimestamp = 0.0
+  private var positionSequence = 0
+
+  // Pending drag sample
+  private var hasPendingDrag = false
+  private var dragIndex = 0
+  private var dragPosition = 0f
+  private var dragDetent = 0f
+  private var dragTimestamp = 0.0
+  private var dragSequence = 0
+
+  /**
+   * Non-realtime samples are settle positions and are dispatched immediately.
+   */
+  fun offerPositionChange(index: Float, position: Float, detent: Float, realtime: Boolean, timestamp: Double) {
+    if (hasPendingPosition) delegate?.coalescerDidDropPositionChange()
+
+    positionIndex = index
+    this.position = position
+    positionDetent = detent
+    positionRealtime = realtime
+    positionTimestamp = timestamp
+    positionSequence++
+    hasPendingPosition = true
+
+    if (realtime) dispatchPending() else flush()
+  }
+
+  fun offerDragChange(index: Int, position: Float, detent: Float, timestamp: Double) {
+    dragIndex = index
+    dragPosition = position
+    dragDetent = detent
+    dragTimestamp = timestamp
+    dragSequence++
+    hasPendingDrag = true
+
+    dispatchPending()
+  }
+
+  /**
+   * Dispatches pending samples regardless of JS progress. Call before discrete events
+   * (drag end, detent change, dismiss) so they never overtake the samples they follow.
+   */
+  fun flush() {
+    if (!hasPendingPosition && !hasPendingDrag) return
+
+    val delegate = delegate ?: return
+    if (hasPendingPosition) {
+      hasPendingPosition = false
+      delegate.coalescerDispatchPositionChange(
+        positionIndex,
+        position,
+        positionDetent,
+        positionRealtime,
+        positionSequence,
+        positionTimestamp
+      )
+    }
+    if (hasPendingDrag) {
+      hasPendingDrag = false
+      delegate.coalescerDispatchDragChange(dragIndex, dragPosition, dragDetent, dragSequence, dragTimestamp)
+    }
+
+    if (!isAwaitingDrain) {
+      isAwaitingDrain = true
+      delegate.coalescerAwaitDrain(drainCallback)
+    }
+  }
+
+  private fun dispatchPending() {
+    if (isAwaitingDrain) return
+    flush()
+  }
+}
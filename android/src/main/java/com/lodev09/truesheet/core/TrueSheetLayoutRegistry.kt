@@ -0,0 +1,37 @@
+package com.lodev09.truesheet.core
+
+import com.facebook.proguard.annotations.DoNotStrip
+import com.facebook.soloader.SoLoader
+
+/**
+ * JNI binding for the shared C++ layout registry in `common/cpp`.
+ * Content, header and footer shadow nodes publish their Yoga heights here during commit,
+ * before the views are mounted and measured. The content node also publishes its ScrollView.
+ */
+@DoNotStrip
+object TrueSheetLayoutRegistry {
+
+  const val UNKNOWN_HEIGHT = -1f
+  const val UNKNOWN_SCROLL_VIEW = -1
+  const val NO_SCROLL_VIEW = 0
+
+  init {
+    SoLoader.loadLibrary("react_codegen_TrueSheetSpec")
+  }
+
+  /**
+   * Last committed height in dp, or [UNKNOWN_HEIGHT].
+   */
+  @JvmStatic
+  external fun getHeight(tag: Int): Float
+
+  /**
+   * Tag of the first ScrollView in the content view, [NO_SCROLL_VIEW] when it has none,
+   * or [UNKNOWN_SCROLL_VIEW] before its first layout.
+   */
+  @JvmStatic
+  external fun getScrollViewTag(tag: Int): Int
+
+  @JvmStatic
+  external fun remove(tag: Int)
+}
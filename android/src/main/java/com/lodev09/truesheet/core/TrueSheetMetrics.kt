@@ -0,0 +1,44 @@
+package com.lodev09.truesheet.core
+
+import com.facebook.proguard.annotations.DoNotStrip
+import com.facebook.react.bridge.WritableNativeMap
+import com.facebook.soloader.SoLoader
+
+/**
+ * JNI binding for the shared C++ metrics collector in `common/cpp`.
+ * Counters are process-wide and read from JS through `TrueSheetModule.getMetrics()`.
+ */
+@DoNotStrip
+object TrueSheetMetrics {
+
+  init {
+    SoLoader.loadLibrary("react_codegen_TrueSheetSpec")
+  }
+
+  @JvmStatic
+  external fun recordPresentLatency(ms: Double)
+
+  @JvmStatic
+  external fun recordDismissLatency(ms: Double)
+
+  @JvmStatic
+  external fun recordPositionEmitted()
+
+  @JvmStatic
+  external fun recordPositionCoalesced()
+
+  @JvmStatic
+  external fun recordStateUpdate()
+
+  @JvmStatic
+  external fun recordDetentReconfiguration()
+
+  @JvmStatic
+  external fun recordPropTransaction(stages: Int)
+
+  @JvmStatic
+  external fun getSnapshot(): WritableNativeMap
+
+  @JvmStatic
+  external fun reset()
+}
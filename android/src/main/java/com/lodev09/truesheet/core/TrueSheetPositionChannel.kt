@@ -0,0 +1,39 @@
+package com.lodev09.truesheet.core
+
+import com.facebook.jni.HybridData
+import com.facebook.proguard.annotations.DoNotStrip
+import com.facebook.soloader.SoLoader
+
+/**
+ * JNI binding for the shared C++ position channel in `common/cpp`.
+ * Every position sample is written here without allocating; JS and worklets read it
+ * synchronously through the `__TrueSheetPositionChannel` JSI binding.
+ */
+@DoNotStrip
+class TrueSheetPositionChannel {
+
+  @DoNotStrip
+  @Suppress("unused")
+  private val mHybridData: HybridData = initHybrid()
+
+  /**
+   * Makes the channel discoverable from JS by the sheet's view tag.
+   */
+  external fun registerTag(tag: Int)
+
+  external fun unregisterTag(tag: Int)
+
+  /**
+   * UI thread only — the channel has a single producer.
+   */
+  external fun write(index: Double, position: Double, detent: Double, timestamp: Double, realtime: Boolean)
+
+  private companion object {
+    init {
+      SoLoader.loadLibrary("react_codegen_TrueSheetSpec")
+    }
+
+    @JvmStatic
+    external fun initHybrid(): HybridData
+  }
+}
@@ -0,0 +1,53 @@
+package com.lodev09.truesheet.core
+
+import com.facebook.jni.HybridData
+import com.facebook.proguard.annotations.DoNotStrip
+import com.facebook.soloader.SoLoader
+
+/**
+ * JNI binding for the shared C++ position sampler in `common/cpp`.
+ * Applies the `positionChangePolicy` prop before `onPositionChange` events are created. Sheets without
+ * a policy skip the native call.
+ */
+@DoNotStrip
+class TrueSheetPositionSampler {
+
+  @DoNotStrip
+  @Suppress("unused")
+  private val mHybridData: HybridData = initHybrid()
+
+  private var isUnrestricted = true
+
+  /**
+   * [maxHz] and [minDelta] are ignored when <= 0. [minDelta] is in dp.
+   */
+  fun setPolicy(settledOnly: Boolean, maxHz: Double, minDelta: Double) {
+    isUnrestricted = !settledOnly && maxHz <= 0 && minDelta <= 0
+    nativeSetPolicy(settledOnly, maxHz, minDelta)
+  }
+
+  /**
+   * Whether a sample should be emitted. Settle (non-realtime) samples always pass.
+   * [timestamp] is in milliseconds.
+   */
+  fun shouldEmit(position: Double, realtime: Boolean, timestamp: Double): Boolean =
+    isUnrestricted || nativeShouldEmit(position, realtime, timestamp)
+
+  /**
+   * Forgets the last emitted sample.
+   */
+  external fun reset()
+
+  private external fun nativeSetPolicy(settledOnly: Boolean, maxHz: Double, minDelta: Double)
+
+  private external fun nativeShouldEmit(position: Double, realtime: Boolean, timestamp: Double): Boolean
+
+  private companion object {
+    init {
+      SoLoader.loadLibrary("react_codegen_TrueSheetSpec")
+    }
+
+    @JvmStatic
+    external fun initHybrid(): HybridData
+  }
+}
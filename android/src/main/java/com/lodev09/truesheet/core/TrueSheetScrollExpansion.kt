@@ -0,0 +1,44 @@
+package com.lodev09.truesheet.core
+
+interface TrueSheetScrollExpansionDelegate {
+  /**
+   * Apply [padding] to the pinned scroll view. Changing its padding relayouts it.
+   */
+  fun scrollExpansionApplyPadding(padding: Int)
+
+  /**
+   * Clamp the scroll offset to the range [padding] would leave, without changing the padding.
+   */
+  fun scrollExpansionClampScroll(padding: Int)
+}
+
+/**
+ * Extra bottom padding that keeps the pinned scroll view's range reachable at smaller detents.
+ *
+ * The padding tracks the sheet position, but applying it relayouts the scrollable content.
+ * While the sheet is dragging or settling, only the scroll offset is clamped, which is the one
+ * visible effect of shrinking the padding. The padding itself is applied once the sheet stops.
+ */
+class TrueSheetScrollExpansion {
+
+  var delegate: TrueSheetScrollExpansionDelegate? = null
+
+  var padding: Int = 0
+    private set
+
+  fun update(padding: Int, isSheetMoving: Boolean) {
+    if (isSheetMoving) {
+      // Growing padding only extends the scroll range, so nothing is visible until it's applied
+      if (padding < this.padding) delegate?.scrollExpansionClampScroll(padding)
+      return
+    }
+
+    if (this.padding == padding) return
+    this.padding = padding
+    delegate?.scrollExpansionApplyPadding(padding)
+  }
+
+  fun reset() {
+    padding = 0
+  }
+}
@@ -0,0 +1,100 @@
+package com.lodev09.truesheet.core
+
+import com.google.android.material.bottomsheet.BottomSheetBehavior
+import kotlin.math.abs
+
+/**
+ * The behavior offsets a released drag settles between, all sheet tops in px.
+ */
+data class TrueSheetSettleOffsets(
+  val parentHeight: Int,
+  val expandedOffset: Int,
+  val halfExpandedOffset: Int,
+  val collapsedOffset: Int,
+  val peekHeight: Int
+)
+
+/**
+ * Picks the state BottomSheetBehavior settles a released drag at.
+ * Mirrors Material 1.12's `onViewReleased` and `shouldHide` with `skipCollapsed` and
+ * `shouldSkipHalfExpandedStateWhenDragging` off, which is how the sheet configures it.
+ */
+object TrueSheetSettlePredictor {
+
+  // BottomSheetBehavior's hide constants
+  private const val HIDE_THRESHOLD = 0.5f
+  private const val HIDE_FRICTION = 0.1f
+
+  /**
+   * @param top Sheet top at release
+   * @param xVelocity Release velocity in px/s, as clamped by ViewDragHelper
+   * @param yVelocity Release velocity in px/s, positive when the sheet moves down
+   * @param significantVelocity The behavior's `significantVelocityThreshold`
+   */
+  fun predictState(
+    top: Int,
+    xVelocity: Float,
+    yVelocity: Float,
+    offsets: TrueSheetSettleOffsets,
+    fitToContents: Boolean,
+    hideable: Boolean,
+    significantVelocity: Int
+  ): Int {
+    val expanded = offsets.expandedOffset
+    val halfExpanded = offsets.halfExpandedOffset
+    val collapsed = offsets.collapsedOffset
+
+    return when {
+      // Moving up
+      yVelocity < 0 -> when {
+        fitToContents -> BottomSheetBehavior.STATE_EXPANDED
+        top > halfExpanded -> BottomSheetBehavior.STATE_HALF_EXPANDED
+        else -> BottomSheetBehavior.STATE_EXPANDED
+      }
+
+      hideable && shouldHide(top, yVelocity, offsets) -> when {
+        // Released low or swiped down significantly, otherwise the closest expanded state
+        abs(xVelocity) < abs(yVelocity) && yVelocity > significantVelocity -> BottomSheetBehavior.STATE_HIDDEN
+        top > (offsets.parentHeight + expanded) / 2 -> BottomSheetBehavior.STATE_HIDDEN
+        fitToContents -> BottomSheetBehavior.STATE_EXPANDED
+        abs(top - expanded) < abs(top - halfExpanded) -> BottomSheetBehavior.STATE_EXPANDED
+        else -> BottomSheetBehavior.STATE_HALF_EXPANDED
+      }
+
+      // At rest or mostly horizontal: the nearest state
+      yVelocity == 0f || abs(xVelocity) > abs(yVelocity) -> when {
+        fitToContents -> if (abs(top - expanded) < abs(top - collapsed)) {
+          BottomSheetBehavior.STATE_EXPANDED
+        } else {
+          BottomSheetBehavior.STATE_COLLAPSED
+        }
+
+        // Material compares against the parent's top here, not the expanded offset
+        top < halfExpanded -> if (top < abs(top - collapsed)) {
+          BottomSheetBehavior.STATE_EXPANDED
+        } else {
+          BottomSheetBehavior.STATE_HALF_EXPANDED
+        }
+
+        abs(top - halfExpanded) < abs(top - collapsed) -> BottomSheetBehavior.STATE_HALF_EXPANDED
+
+        else -> BottomSheetBehavior.STATE_COLLAPSED
+      }
+
+      // Moving down: the nearer of half-expanded and collapsed
+      fitToContents -> BottomSheetBehavior.STATE_COLLAPSED
+
+      abs(top - halfExpanded) < abs(top - collapsed) -> BottomSheetBehavior.STATE_HALF_EXPANDED
+
+      else -> BottomSheetBehavior.STATE_COLLAPSED
+    }
+  }
+
+  private fun shouldHide(top: Int, yVelocity: Float, offsets: TrueSheetSettleOffsets): Boolean {
+    // Above collapsed it collapses instead
+    if (top < offsets.collapsedOffset) return false
+
+    val newTop = top + yVelocity * HIDE_FRICTION
+    return abs(newTop - offsets.collapsedOffset) / offsets.peekHeight.toFloat() > HIDE_THRESHOLD
+  }
+}
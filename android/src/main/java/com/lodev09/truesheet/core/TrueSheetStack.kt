@@ -0,0 +1,121 @@
+package com.lodev09.truesheet.core
+
+/**
+ * Sheets stacked per container, bottom to top.
+ * Each sheet knows its container and index, so parent, topmost and sheets-above queries
+ * don't scan other containers. Not thread safe, [TrueSheetStackManager] guards it.
+ */
+class TrueSheetStack<C, S : Any> {
+
+  /**
+   * A registered sheet's place in its container's stack.
+   * [order] is the registration sequence, used to compare sheets across containers.
+   */
+  private class Entry<K>(val container: K, val order: Long) {
+    var index = 0
+  }
+
+  private val stacks = HashMap<C, ArrayList<S>>()
+  private val entries = HashMap<S, Entry<C>>()
+  private var nextOrder = 0L
+
+  val size: Int
+    get() = entries.size
+
+  private fun stackOf(entry: Entry<C>): ArrayList<S> = stacks.getValue(entry.container)
+
+  /**
+   * Pushes [sheet] on top of [container]'s stack. Returns false if it is already registered.
+   */
+  fun register(sheet: S, container: C): Boolean {
+    if (entries.containsKey(sheet)) return false
+
+    val stack = stacks.getOrPut(container) { ArrayList() }
+    entries[sheet] = Entry(container, nextOrder++).apply { index = stack.size }
+    stack.add(sheet)
+    return true
+  }
+
+  /**
+   * Removes [sheet] from its stack. Returns false if it isn't registered.
+   */
+  fun unregister(sheet: S): Boolean {
+    val entry = entries.remove(sheet) ?: return false
+    val stack = stackOf(entry)
+    stack.removeAt(entry.index)
+
+    // Sheets above shift down one slot
+    for (i in entry.index until stack.size) {
+      entries.getValue(stack[i]).index = i
+    }
+    if (stack.isEmpty()) {
+      stacks.remove(entry.container)
+    }
+    return true
+  }
+
+  fun clear() {
+    stacks.clear()
+    entries.clear()
+  }
+
+  fun contains(sheet: S): Boolean = entries.containsKey(sheet)
+
+  fun containerOf(sheet: S): C? = entries[sheet]?.container
+
+  /**
+   * The sheet directly below [sheet] in its container, if any.
+   */
+  fun parentOf(sheet: S): S? {
+    val entry = entries[sheet] ?: return null
+    if (entry.index <= 0) return null
+    return stackOf(entry)[entry.index - 1]
+  }
+
+  fun isTopmost(sheet: S): Boolean {
+    val entry = entries[sheet] ?: return false
+    return entry.index == stackOf(entry).size - 1
+  }
+
+  /**
+   * Sheets above [sheet] in its container, topmost first.
+   */
+  fun sheetsAbove(sheet: S): List<S> {
+    val entry = entries[sheet] ?: return emptyList()
+    val stack = stackOf(entry)
+    if (entry.index >= stack.size - 1) return emptyList()
+    return stack.subList(entry.index + 1, stack.size).reversed()
+  }
+
+  /**
+   * [sheet] and the sheets above it in its container, bottom to top.
+   */
+  fun sheetsFrom(sheet: S): List<S> {
+    val entry = entries[sheet] ?: return emptyList()
+    val stack = stackOf(entry)
+    return stack.subList(entry.index, stack.size)
+  }
+
+  /**
+   * Returns the most recently registered sheet across containers matching [predicate].
+   * Each container is scanned from its top, so this is usually one check per container.
+   */
+  fun findLast(predicate: (S) -> Boolean): S? {
+    var result: S? = null
+    var resultOrder = Long.MIN_VALUE
+    for (stack in stacks.values) {
+      for (i in stack.indices.reversed()) {
+        val sheet = stack[i]
+        if (!predicate(sheet)) continue
+
+        val order = entries.getValue(sheet).order
+        if (order > resultOrder) {
+          result = sheet
+          resultOrder = order
+        }
+        break
+      }
+    }
+    return result
+  }
+}
@@ -7,27 +7,21 @@ import com.lodev09.truesheet.TrueSheetView
 /**
  * Manages TrueSheet stacking behavior.
  * Tracks presented sheets and handles visibility when sheets stack on top of each other.
+ * Sheets are stacked per root container in a [TrueSheetStack].
  */
 object TrueSheetStackManager {
 
-  private val presentedSheetStack = mutableListOf<TrueSheetView>()
+  private val lock = Any()
 
-  /**
-   * Gets the parent sheet at the given index, if any.
-   * Only returns a parent if it's in the same container.
-   * Must be called within synchronized block.
-   */
-  private fun getParentSheetAt(index: Int, rootContainer: ViewGroup?): TrueSheetView? {
-    if (index <= 0) return null
-    return presentedSheetStack[index - 1].takeIf { it.rootContainerView == rootContainer }
-  }
+  // Presented sheets per root container
+  private val stack = TrueSheetStack<ViewGroup?, TrueSheetView>()
 
   /**
    * Returns the topmost presented and visible sheet.
    * Must be called within synchronized block.
    */
   private fun findTopmostSheet(): TrueSheetView? =
-    presentedSheetStack.lastOrNull {
+    stack.findLast {
       it.viewController.isPresented && it.viewController.isSheetVisible
     }
 
@@ -37,13 +31,10 @@ object TrueSheetStackManager {
    */
   @JvmStatic
   fun registerSheet(sheetView: TrueSheetView): TrueSheetView? {
-    synchronized(presentedSheetStack) {
-      val parentSheet = findTopmostSheet()?.takeIf { it.rootContainerView == sheetView.rootContainerView }
-
-      if (!presentedSheetStack.contains(sheetView)) {
-        presentedSheetStack.add(sheetView)
-      }
-
+    synchronized(lock) {
+      val container = sheetView.rootContainerView
+      val parentSheet = findTopmostSheet()?.takeIf { stack.containerOf(it) == container }
+      stack.register(sheetView, container)
       return parentSheet
     }
   }
@@ -53,8 +44,8 @@ object TrueSheetStackManager {
    */
   @JvmStatic
   fun unregisterSheet(sheetView: TrueSheetView) {
-    synchronized(presentedSheetStack) {
-      presentedSheetStack.remove(sheetView)
+    synchronized(lock) {
+      stack.unregister(sheetView)
     }
   }
 
@@ -64,20 +55,16 @@ object TrueSheetStackManager {
    */
   @JvmStatic
   fun updateParentTranslation(sheetView: TrueSheetView) {
-    synchronized(presentedSheetStack) {
-      val index = presentedSheetStack.indexOf(sheetView)
-      val parentSheet = getParentSheetAt(index, sheetView.rootContainerView) ?: return
-
-      // Post to ensure layout is complete before reading position
-      sheetView.viewController.post {
-        val childMinSheetTop = sheetView.viewController.detentCalculator.getSheetTopForDetentIndex(0)
-        val childCurrentSheetTop = sheetView.viewController.detentCalculator.getSheetTopForDetentIndex(
-          sheetView.viewController.currentDetentIndex
-        )
-        // Cap to minimum detent position
-        val childSheetTop = maxOf(childMinSheetTop, childCurrentSheetTop)
-        parentSheet.updateTranslationForChild(childSheetTop)
-      }
+    val parentSheet = getParentSheet(sheetView) ?: return
+
+    // Post to ensure layout is complete before reading position
+    sheetView.viewController.post {
+      val detentCalculator = sheetView.viewController.detentCalculator
+      val childMinSheetTop = detentCalculator.getSheetTopForDetentIndex(0)
+      val childCurrentSheetTop = detentCalculator.getSheetTopForDetentIndex(sheetView.viewController.currentDetentIndex)
+      // Cap to minimum detent position
+      val childSheetTop = maxOf(childMinSheetTop, childCurrentSheetTop)
+      parentSheet.updateTranslationForChild(childSheetTop)
     }
   }
 
@@ -87,27 +74,20 @@ object TrueSheetStackManager {
    */
   @JvmStatic
   fun getSheetsAbove(sheetView: TrueSheetView): List<TrueSheetView> {
-    synchronized(presentedSheetStack) {
-      val index = presentedSheetStack.indexOf(sheetView)
-      if (index < 0 || index >= presentedSheetStack.size - 1) return emptyList()
-      val rootContainer = sheetView.rootContainerView
-      return presentedSheetStack.subList(index + 1, presentedSheetStack.size)
-        .filter { it.rootContainerView == rootContainer }
-        .reversed()
+    synchronized(lock) {
+      return stack.sheetsAbove(sheetView)
     }
   }
 
   @JvmStatic
   fun removeSheet(sheetView: TrueSheetView) {
-    synchronized(presentedSheetStack) {
-      presentedSheetStack.remove(sheetView)
-    }
+    unregisterSheet(sheetView)
   }
 
   @JvmStatic
   fun clear() {
-    synchronized(presentedSheetStack) {
-      presentedSheetStack.clear()
+    synchronized(lock) {
+      stack.clear()
     }
   }
 
@@ -117,9 +97,8 @@ object TrueSheetStackManager {
    */
   @JvmStatic
   fun getParentSheet(sheetView: TrueSheetView): TrueSheetView? {
-    synchronized(presentedSheetStack) {
-      val index = presentedSheetStack.indexOf(sheetView)
-      return getParentSheetAt(index, sheetView.rootContainerView)
+    synchronized(lock) {
+      return stack.parentOf(sheetView)
     }
   }
 
@@ -128,9 +107,8 @@ object TrueSheetStackManager {
    */
   @JvmStatic
   fun isTopmostSheet(sheetView: TrueSheetView): Boolean {
-    synchronized(presentedSheetStack) {
-      val rootContainer = sheetView.rootContainerView
-      return presentedSheetStack.lastOrNull { it.rootContainerView == rootContainer } == sheetView
+    synchronized(lock) {
+      return stack.isTopmost(sheetView)
     }
   }
 
@@ -139,12 +117,13 @@ object TrueSheetStackManager {
    */
   @JvmStatic
   fun getTopmostSheet(): TrueSheetView? {
-    synchronized(presentedSheetStack) {
+    synchronized(lock) {
       return findTopmostSheet()
     }
   }
 
   private val savedBackgroundImportance = HashMap<View, Int>()
+  private var accessibilityRoot: ViewGroup? = null
 
   /**
    * Hides views behind the topmost dimmed (modal) sheet from accessibility,
@@ -152,42 +131,52 @@ object TrueSheetStackManager {
    * the app content, so without this TalkBack can traverse behind the sheet.
    *
    * Derived from the current stack state and idempotent — call whenever a
-   * sheet presents, dismisses, settles, or changes its dim state.
+   * sheet presents, dismisses, settles, or changes its dim state. Only views
+   * whose importance differs from the previous state are written.
    */
   @JvmStatic
   fun updateBackgroundAccessibility() {
-    synchronized(presentedSheetStack) {
-      val topDimmedIndex = presentedSheetStack.indexOfLast {
-        it.viewController.run { isPresented && isSheetVisible && !isBeingDismissed && isDimmedAtCurrentDetent }
+    synchronized(lock) {
+      val topDimmed = stack.findLast {
+        it.viewController.run {
+          isPresented && isSheetVisible && !isBeingDismissed && !isPendingStackDismiss && isDimmedAtCurrentDetent
+        }
       }
-      val topDimmed = presentedSheetStack.getOrNull(topDimmedIndex)
       val root = topDimmed?.viewController?.coordinatorLayout?.parent as? ViewGroup
 
-      if (root == null) {
+      if (root == null || root !== accessibilityRoot) {
         restoreBackgroundAccessibility()
-        return
+        accessibilityRoot = root
       }
+      if (root == null || topDimmed == null) return
 
       // The dimmed sheet and any sheets above it stay accessible
-      val accessibleCoordinators = presentedSheetStack
-        .subList(topDimmedIndex, presentedSheetStack.size)
-        .mapNotNull { it.viewController.coordinatorLayout }
-        .toSet()
+      val accessibleSheets = stack.sheetsFrom(topDimmed)
 
       for (i in 0 until root.childCount) {
         val child = root.getChildAt(i)
-        if (child in accessibleCoordinators) {
+        if (isSheetCoordinator(child, accessibleSheets)) {
           savedBackgroundImportance.remove(child)?.let { child.importantForAccessibility = it }
           continue
         }
         if (!savedBackgroundImportance.containsKey(child)) {
           savedBackgroundImportance[child] = child.importantForAccessibility
         }
-        child.importantForAccessibility = View.IMPORTANT_FOR_ACCESSIBILITY_NO_HIDE_DESCENDANTS
+        // Rewritten whenever something else reset it since it was saved
+        if (child.importantForAccessibility != View.IMPORTANT_FOR_ACCESSIBILITY_NO_HIDE_DESCENDANTS) {
+          child.importantForAccessibility = View.IMPORTANT_FOR_ACCESSIBILITY_NO_HIDE_DESCENDANTS
+        }
       }
     }
   }
 
+  private fun isSheetCoordinator(view: View, sheets: List<TrueSheetView>): Boolean {
+    for (sheet in sheets) {
+      if (sheet.viewController.coordinatorLayout === view) return true
+    }
+    return false
+  }
+
   private fun restoreBackgroundAccessibility() {
     savedBackgroundImportance.forEach { (view, importance) ->
       view.importantForAccessibility = importance
@@ -202,8 +191,8 @@ object TrueSheetStackManager {
    */
   @JvmStatic
   fun getRootSheet(): TrueSheetView? {
-    synchronized(presentedSheetStack) {
-      val topmost = presentedSheetStack.lastOrNull { it.viewController.isPresented } ?: return null
+    synchronized(lock) {
+      val topmost = stack.findLast { it.viewController.isPresented } ?: return null
 
       var current: TrueSheetView = topmost
       while (true) {
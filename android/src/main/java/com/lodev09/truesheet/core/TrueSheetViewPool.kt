@@ -0,0 +1,83 @@
+package com.lodev09.truesheet.core
+
+import android.os.Looper
+import android.view.ViewGroup
+import androidx.annotation.UiThread
+import com.facebook.react.uimanager.ThemedReactContext
+
+/**
+ * Recycles the native sheet hosts (coordinator layout and bottom sheet view) between sheets.
+ *
+ * A sheet acquires its hosts when presenting and releases them after dismissing. Hosts are
+ * tied to the surface context they were created with, so only hosts from the same context are
+ * handed out. [prewarm] fills the pool while the UI thread is idle, which takes host creation
+ * off the first present.
+ */
+object TrueSheetViewPool {
+
+  private const val MAX_POOL_SIZE = 2
+
+  private val coordinatorLayouts = ArrayDeque<TrueSheetCoordinatorLayout>()
+  private val sheetViews = ArrayDeque<TrueSheetBottomSheetView>()
+  private var isPrewarmScheduled = false
+
+  @UiThread
+  fun acquireCoordinatorLayout(reactContext: ThemedReactContext): TrueSheetCoordinatorLayout =
+    take(coordinatorLayouts, reactContext) ?: TrueSheetCoordinatorLayout(reactContext)
+
+  @UiThread
+  fun acquireSheetView(reactContext: ThemedReactContext): TrueSheetBottomSheetView =
+    take(sheetViews, reactContext) ?: TrueSheetBottomSheetView(reactContext)
+
+  /**
+   * Resets the hosts and keeps them for the next sheet. Callers must have removed their
+   * content and behavior callbacks first.
+   */
+  @UiThread
+  fun release(coordinatorLayout: TrueSheetCoordinatorLayout, sheetView: TrueSheetBottomSheetView) {
+    sheetView.recycle()
+    coordinatorLayout.recycle()
+    (coordinatorLayout.parent as? ViewGroup)?.removeView(coordinatorLayout)
+
+    if (sheetViews.size < MAX_POOL_SIZE) sheetViews.addLast(sheetView)
+    if (coordinatorLayouts.size < MAX_POOL_SIZE) coordinatorLayouts.addLast(coordinatorLayout)
+  }
+
+  /**
+   * Creates hosts for [reactContext] on the next idle pass of the UI thread.
+   */
+  @UiThread
+  fun prewarm(reactContext: ThemedReactContext) {
+    if (isPrewarmScheduled) return
+    isPrewarmScheduled = true
+
+    Looper.myQueue().addIdleHandler {
+      isPrewarmScheduled = false
+      if (reactContext.hasActiveReactInstance()) {
+        evictStale(coordinatorLayouts, reactContext)
+        evictStale(sheetViews, reactContext)
+        while (coordinatorLayouts.size < MAX_POOL_SIZE) coordinatorLayouts.addLast(TrueSheetCoordinatorLayout(reactContext))
+        while (sheetViews.size < MAX_POOL_SIZE) sheetViews.addLast(TrueSheetBottomSheetView(reactContext))
+      }
+      false
+    }
+  }
+
+  @UiThread
+  fun clear() {
+    coordinatorLayouts.clear()
+    sheetViews.clear()
+  }
+
+  private fun <T : ViewGroup> take(pool: ArrayDeque<T>, reactContext: ThemedReactContext): T? {
+    evictStale(pool, reactContext)
+    return pool.removeLastOrNull()
+  }
+
+  /**
+   * Drops hosts created for another surface so they don't outlive it.
+   */
+  private fun <T : ViewGroup> evictStale(pool: ArrayDeque<T>, reactContext: ThemedReactContext) {
+    pool.removeAll { it.context !== reactContext }
+  }
+}
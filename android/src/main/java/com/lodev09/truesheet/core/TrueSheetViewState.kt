@@ -0,0 +1,34 @@
+package com.lodev09.truesheet.core
+
+import com.facebook.react.bridge.WritableNativeMap
+import com.facebook.react.uimanager.StateWrapper
+
+/**
+ * Reads and writes the sheet's Fabric state (`TrueSheetViewState` in `common/cpp`).
+ * The state is exposed to Kotlin as a MapBuffer; keys mirror `kContainerWidthKey` and `kContainerHeightKey`.
+ */
+object TrueSheetViewState {
+  const val CONTAINER_WIDTH_KEY = 0
+  const val CONTAINER_HEIGHT_KEY = 1
+
+  /**
+   * Whether the committed state already holds this container size (dp).
+   */
+  fun hasContainerSize(stateWrapper: StateWrapper, width: Float, height: Float): Boolean {
+    val state = stateWrapper.stateDataMapBuffer ?: return false
+    if (!state.contains(CONTAINER_WIDTH_KEY) || !state.contains(CONTAINER_HEIGHT_KEY)) return false
+
+    return state.getDouble(CONTAINER_WIDTH_KEY).toFloat() == width &&
+      state.getDouble(CONTAINER_HEIGHT_KEY).toFloat() == height
+  }
+
+  /**
+   * Commits the container size (dp).
+   */
+  fun updateContainerSize(stateWrapper: StateWrapper, width: Float, height: Float) {
+    val newStateData = WritableNativeMap()
+    newStateData.putDouble("containerWidth", width.toDouble())
+    newStateData.putDouble("containerHeight", height.toDouble())
+    stateWrapper.updateState(newStateData)
+  }
+}
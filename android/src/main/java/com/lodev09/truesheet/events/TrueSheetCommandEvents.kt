@@ -0,0 +1,35 @@
+package com.lodev09.truesheet.events
+
+import com.facebook.react.bridge.Arguments
+import com.facebook.react.bridge.WritableMap
+import com.facebook.react.uimanager.events.Event
+
+/**
+ * Fired when a command from the JSI command queue finishes
+ * Payload: { id: number, error: string, superseded: boolean }, `error` is empty on success
+ */
+class CommandCompleteEvent(
+  surfaceId: Int,
+  viewId: Int,
+  private val commandId: Int,
+  private val error: String?,
+  private val superseded: Boolean
+) : Event<CommandCompleteEvent>(surfaceId, viewId) {
+
+  override fun getEventName(): String = EVENT_NAME
+
+  // Every completion must reach JS
+  override fun canCoalesce(): Boolean = false
+
+  override fun getEventData(): WritableMap =
+    Arguments.createMap().apply {
+      putInt("id", commandId)
+      putString("error", error ?: "")
+      putBoolean("superseded", superseded)
+    }
+
+  companion object {
+    const val EVENT_NAME = "topCommandComplete"
+    const val REGISTRATION_NAME = "onCommandComplete"
+  }
+}
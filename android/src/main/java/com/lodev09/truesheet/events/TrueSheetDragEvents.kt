@@ -1,5 +1,6 @@
 package com.lodev09.truesheet.events
 
+import androidx.core.util.Pools
 import com.facebook.react.bridge.Arguments
 import com.facebook.react.bridge.WritableMap
 import com.facebook.react.uimanager.events.Event
@@ -27,11 +28,17 @@ class DragBeginEvent(surfaceId: Int, viewId: Int, private val index: Int, privat
 }
 
 /**
- * Fired continuously during dragging
- * Payload: { index: number, position: number, detent: number }
+ * Fired continuously during dragging. Coalesced by [com.lodev09.truesheet.core.TrueSheetEventCoalescer]
+ * and pooled, so use [obtain] instead of the constructor.
+ * Payload: { index: number, position: number, detent: number, sequence: number, timestamp: number }
  */
-class DragChangeEvent(surfaceId: Int, viewId: Int, private val index: Int, private val position: Float, private val detent: Float) :
-  Event<DragChangeEvent>(surfaceId, viewId) {
+class DragChangeEvent private constructor() : Event<DragChangeEvent>() {
+
+  private var index = 0
+  private var position = 0f
+  private var detent = 0f
+  private var sequence = 0
+  private var timestamp = 0.0
 
   override fun getEventName(): String = EVENT_NAME
 
@@ -40,11 +47,47 @@ class DragChangeEvent(surfaceId: Int, viewId: Int, private val index: Int, priva
       putInt("index", index)
       putDouble("position", position.toDouble())
       putDouble("detent", detent.toDouble())
+      putInt("sequence", sequence)
+      putDouble("timestamp", timestamp)
     }
 
+  private fun setUp(
+    surfaceId: Int,
+    viewId: Int,
+    index: Int,
+    position: Float,
+    detent: Float,
+    sequence: Int,
+    timestamp: Double
+  ) {
+    init(surfaceId, viewId)
+    this.index = index
+    this.position = position
+    this.detent = detent
+    this.sequence = sequence
+    this.timestamp = timestamp
+  }
+
+  override fun onDispose() {
+    EVENTS_POOL.release(this)
+  }
+
   companion object {
     const val EVENT_NAME = "topDragChange"
     const val REGISTRATION_NAME = "onDragChange"
+
+    private val EVENTS_POOL = Pools.SynchronizedPool<DragChangeEvent>(3)
+
+    fun obtain(
+      surfaceId: Int,
+      viewId: Int,
+      index: Int,
+      position: Float,
+      detent: Float,
+      sequence: Int,
+      timestamp: Double
+    ): DragChangeEvent =
+      (EVENTS_POOL.acquire() ?: DragChangeEvent()).also { it.setUp(surfaceId, viewId, index, position, detent, sequence, timestamp) }
   }
 }
 
@@ -69,3 +112,32 @@ class DragEndEvent(surfaceId: Int, viewId: Int, private val index: Int, private
     const val REGISTRATION_NAME = "onDragEnd"
   }
 }
+
+/**
+ * Fired when a drag is released, with the detent the sheet is predicted to settle at
+ * Payload: { index: number, position: number, detent: number, duration: number }
+ */
+class WillSettleEvent(
+  surfaceId: Int,
+  viewId: Int,
+  private val index: Int,
+  private val position: Float,
+  private val detent: Float,
+  private val duration: Int
+) : Event<WillSettleEvent>(surfaceId, viewId) {
+
+  override fun getEventName(): String = EVENT_NAME
+
+  override fun getEventData(): WritableMap =
+    Arguments.createMap().apply {
+      putInt("index", index)
+      putDouble("position", position.toDouble())
+      putDouble("detent", detent.toDouble())
+      putDouble("duration", duration.toDouble())
+    }
+
+  companion object {
+    const val EVENT_NAME = "topWillSettle"
+    const val REGISTRATION_NAME = "onWillSettle"
+  }
+}
@@ -1,5 +1,6 @@
 package com.lodev09.truesheet.events
 
+import androidx.core.util.Pools
 import com.facebook.react.bridge.Arguments
 import com.facebook.react.bridge.WritableMap
 import com.facebook.react.uimanager.events.Event
@@ -27,17 +28,19 @@ class DetentChangeEvent(surfaceId: Int, viewId: Int, private val index: Int, pri
 }
 
 /**
- * Fired continuously for position updates during drag and animation
- * Payload: { index: number, position: number, detent: number, realtime: boolean }
+ * Fired continuously for position updates during drag and animation.
+ * Coalesced by [com.lodev09.truesheet.core.TrueSheetEventCoalescer] and pooled, so use [obtain]
+ * instead of the constructor.
+ * Payload: { index: number, position: number, detent: number, realtime: boolean, sequence: number, timestamp: number }
  */
-class PositionChangeEvent(
-  surfaceId: Int,
-  viewId: Int,
-  private val index: Float,
-  private val position: Float,
-  private val detent: Float,
-  private val realtime: Boolean = false
-) : Event<PositionChangeEvent>(surfaceId, viewId) {
+class PositionChangeEvent private constructor() : Event<PositionChangeEvent>() {
+
+  private var index = 0f
+  private var position = 0f
+  private var detent = 0f
+  private var realtime = false
+  private var sequence = 0
+  private var timestamp = 0.0
 
   override fun getEventName(): String = EVENT_NAME
 
@@ -47,10 +50,51 @@ class PositionChangeEvent(
       putDouble("position", position.toDouble())
       putDouble("detent", detent.toDouble())
       putBoolean("realtime", realtime)
+      putInt("sequence", sequence)
+      putDouble("timestamp", timestamp)
     }
 
+  private fun setUp(
+    surfaceId: Int,
+    viewId: Int,
+    index: Float,
+    position: Float,
+    detent: Float,
+    realtime: Boolean,
+    sequence: Int,
+    timestamp: Double
+  ) {
+    init(surfaceId, viewId)
+    this.index = index
+    this.position = position
+    this.detent = detent
+    this.realtime = realtime
+    this.sequence = sequence
+    this.timestamp = timestamp
+  }
+
+  override fun onDispose() {
+    EVENTS_POOL.release(this)
+  }
+
   companion object {
     const val EVENT_NAME = "topPositionChange"
     const val REGISTRATION_NAME = "onPositionChange"
+
+    private val EVENTS_POOL = Pools.SynchronizedPool<PositionChangeEvent>(3)
+
+    fun obtain(
+      surfaceId: Int,
+      viewId: Int,
+      index: Float,
+      position: Float,
+      detent: Float,
+      realtime: Boolean,
+      sequence: Int,
+      timestamp: Double
+    ): PositionChangeEvent =
+      (EVENTS_POOL.acquire() ?: PositionChangeEvent()).also {
+        it.setUp(surfaceId, viewId, index, position, detent, realtime, sequence, timestamp)
+      }
   }
 }
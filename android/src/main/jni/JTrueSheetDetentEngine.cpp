@@ -0,0 +1,85 @@
+#include "JTrueSheetDetentEngine.h"
+
+namespace facebook::react {
+
+jni::local_ref<JTrueSheetDetentEngine::jhybriddata> JTrueSheetDetentEngine::initHybrid(jni::alias_ref<jclass>) {
+  return makeCxxInstance();
+}
+
+void JTrueSheetDetentEngine::registerNatives() {
+  registerHybrid({
+    makeNativeMethod("initHybrid", JTrueSheetDetentEngine::initHybrid),
+    makeNativeMethod("setDetents", JTrueSheetDetentEngine::setDetents),
+    makeNativeMethod("setLayout", JTrueSheetDetentEngine::setLayout),
+    makeNativeMethod("getDetentValue", JTrueSheetDetentEngine::getDetentValue),
+    makeNativeMethod("getDetentHeight", JTrueSheetDetentEngine::getDetentHeight),
+    makeNativeMethod("getResolvedHeight", JTrueSheetDetentEngine::getResolvedHeight),
+    makeNativeMethod("findSegment", JTrueSheetDetentEngine::findSegment),
+    makeNativeMethod("getInterpolatedIndex", JTrueSheetDetentEngine::getInterpolatedIndex),
+    makeNativeMethod("getInterpolatedDetent", JTrueSheetDetentEngine::getInterpolatedDetent),
+  });
+}
+
+void JTrueSheetDetentEngine::setDetents(jni::alias_ref<jni::JArrayDouble> detents) {
+  auto size = detents->size();
+  auto values = detents->getRegion(0, size);
+  engine_.setDetents(values.get(), size);
+}
+
+void JTrueSheetDetentEngine::setLayout(
+  double screenHeight,
+  double containerHeight,
+  double contentHeight,
+  double headerHeight,
+  double footerHeight,
+  double peekContentHeight,
+  double peekFallbackHeight,
+  double bottomInset,
+  double keyboardInset,
+  double topInset,
+  double maxContentHeight) {
+  TrueSheetDetentLayout layout;
+  layout.screenHeight = screenHeight;
+  layout.containerHeight = containerHeight;
+  layout.contentHeight = contentHeight;
+  layout.headerHeight = headerHeight;
+  layout.footerHeight = footerHeight;
+  layout.peekContentHeight = peekContentHeight;
+  layout.peekFallbackHeight = peekFallbackHeight;
+  layout.bottomInset = bottomInset;
+  layout.keyboardInset = keyboardInset;
+  layout.topInset = topInset;
+  layout.maxContentHeight = maxContentHeight;
+  // Sheet positions on Android are whole pixels
+  layout.integralHeights = true;
+  engine_.setLayout(layout);
+}
+
+double JTrueSheetDetentEngine::getDetentValue(jint index) {
+  return engine_.getDetentValue(index);
+}
+
+double JTrueSheetDetentEngine::getDetentHeight(double detent, jboolean includeKeyboard) {
+  return engine_.getDetentHeight(detent, includeKeyboard);
+}
+
+double JTrueSheetDetentEngine::getResolvedHeight(jint index) {
+  return engine_.getResolvedHeight(index);
+}
+
+void JTrueSheetDetentEngine::findSegment(double sheetHeight, jni::alias_ref<jni::JArrayDouble> out) {
+  auto segment = engine_.findSegment(sheetHeight);
+  double values[3] = {
+    static_cast<double>(segment.fromIndex), static_cast<double>(segment.toIndex), segment.progress};
+  out->setRegion(0, 3, values);
+}
+
+double JTrueSheetDetentEngine::getInterpolatedIndex(double sheetHeight) {
+  return engine_.getInterpolatedIndex(sheetHeight);
+}
+
+double JTrueSheetDetentEngine::getInterpolatedDetent(double sheetHeight) {
+  return engine_.getInterpolatedDetent(sheetHeight);
+}
+
+} // namespace facebook::react
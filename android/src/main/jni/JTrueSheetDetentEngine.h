@@ -0,0 +1,47 @@
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include <react/renderer/components/TrueSheetSpec/TrueSheetDetentEngine.h>
+
+namespace facebook::react {
+
+/*
+ * fbjni hybrid backing `com.lodev09.truesheet.core.TrueSheetDetentEngine`.
+ */
+class JTrueSheetDetentEngine : public jni::HybridClass<JTrueSheetDetentEngine> {
+ public:
+  static constexpr auto kJavaDescriptor = "Lcom/lodev09/truesheet/core/TrueSheetDetentEngine;";
+
+  static jni::local_ref<jhybriddata> initHybrid(jni::alias_ref<jclass>);
+
+  static void registerNatives();
+
+ private:
+  friend HybridBase;
+
+  JTrueSheetDetentEngine() = default;
+
+  void setDetents(jni::alias_ref<jni::JArrayDouble> detents);
+  void setLayout(
+    double screenHeight,
+    double containerHeight,
+    double contentHeight,
+    double headerHeight,
+    double footerHeight,
+    double peekContentHeight,
+    double peekFallbackHeight,
+    double bottomInset,
+    double keyboardInset,
+    double topInset,
+    double maxContentHeight);
+  double getDetentValue(jint index);
+  double getDetentHeight(double detent, jboolean includeKeyboard);
+  double getResolvedHeight(jint index);
+  void findSegment(double sheetHeight, jni::alias_ref<jni::JArrayDouble> out);
+  double getInterpolatedIndex(double sheetHeight);
+  double getInterpolatedDetent(double sheetHeight);
+
+  TrueSheetDetentEngine engine_;
+};
+
+} // namespace facebook::react
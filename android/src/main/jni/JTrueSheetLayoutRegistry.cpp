@@ -0,0 +1,27 @@
+#include "JTrueSheetLayoutRegistry.h"
+
+#include <react/renderer/components/TrueSheetSpec/TrueSheetLayoutRegistry.h>
+
+namespace facebook::react {
+
+void JTrueSheetLayoutRegistry::registerNatives() {
+  javaClassStatic()->registerNatives({
+    makeNativeMethod("getHeight", JTrueSheetLayoutRegistry::getHeight),
+    makeNativeMethod("getScrollViewTag", JTrueSheetLayoutRegistry::getScrollViewTag),
+    makeNativeMethod("remove", JTrueSheetLayoutRegistry::remove),
+  });
+}
+
+jfloat JTrueSheetLayoutRegistry::getHeight(jni::alias_ref<jclass>, jint tag) {
+  return static_cast<jfloat>(TrueSheetLayoutRegistry::getHeight(tag));
+}
+
+jint JTrueSheetLayoutRegistry::getScrollViewTag(jni::alias_ref<jclass>, jint tag) {
+  return static_cast<jint>(TrueSheetLayoutRegistry::getScrollViewTag(tag));
+}
+
+void JTrueSheetLayoutRegistry::remove(jni::alias_ref<jclass>, jint tag) {
+  TrueSheetLayoutRegistry::remove(tag);
+}
+
+} // namespace facebook::react
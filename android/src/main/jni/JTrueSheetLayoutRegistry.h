@@ -0,0 +1,22 @@
+#pragma once
+
+#include <fbjni/fbjni.h>
+
+namespace facebook::react {
+
+/*
+ * Static natives of `com.lodev09.truesheet.core.TrueSheetLayoutRegistry`.
+ */
+class JTrueSheetLayoutRegistry : public jni::JavaClass<JTrueSheetLayoutRegistry> {
+ public:
+  static constexpr auto kJavaDescriptor = "Lcom/lodev09/truesheet/core/TrueSheetLayoutRegistry;";
+
+  static void registerNatives();
+
+ private:
+  static jfloat getHeight(jni::alias_ref<jclass>, jint tag);
+  static jint getScrollViewTag(jni::alias_ref<jclass>, jint tag);
+  static void remove(jni::alias_ref<jclass>, jint tag);
+};
+
+} // namespace facebook::react
@@ -0,0 +1,57 @@
+#include "JTrueSheetMetrics.h"
+
+#include <react/renderer/components/TrueSheetSpec/TrueSheetMetrics.h>
+
+namespace facebook::react {
+
+void JTrueSheetMetrics::registerNatives() {
+  javaClassStatic()->registerNatives({
+    makeNativeMethod("recordPresentLatency", JTrueSheetMetrics::recordPresentLatency),
+    makeNativeMethod("recordDismissLatency", JTrueSheetMetrics::recordDismissLatency),
+    makeNativeMethod("recordPositionEmitted", JTrueSheetMetrics::recordPositionEmitted),
+    makeNativeMethod("recordPositionCoalesced", JTrueSheetMetrics::recordPositionCoalesced),
+    makeNativeMethod("recordStateUpdate", JTrueSheetMetrics::recordStateUpdate),
+    makeNativeMethod("recordDetentReconfiguration", JTrueSheetMetrics::recordDetentReconfiguration),
+    makeNativeMethod("recordPropTransaction", JTrueSheetMetrics::recordPropTransaction),
+    makeNativeMethod("getSnapshot", JTrueSheetMetrics::getSnapshot),
+    makeNativeMethod("reset", JTrueSheetMetrics::reset),
+  });
+}
+
+void JTrueSheetMetrics::recordPresentLatency(jni::alias_ref<jclass>, double ms) {
+  TrueSheetMetrics::shared().recordPresentLatency(ms);
+}
+
+void JTrueSheetMetrics::recordDismissLatency(jni::alias_ref<jclass>, double ms) {
+  TrueSheetMetrics::shared().recordDismissLatency(ms);
+}
+
+void JTrueSheetMetrics::recordPositionEmitted(jni::alias_ref<jclass>) {
+  TrueSheetMetrics::shared().recordPositionEmitted();
+}
+
+void JTrueSheetMetrics::recordPositionCoalesced(jni::alias_ref<jclass>) {
+  TrueSheetMetrics::shared().recordPositionCoalesced();
+}
+
+void JTrueSheetMetrics::recordStateUpdate(jni::alias_ref<jclass>) {
+  TrueSheetMetrics::shared().recordStateUpdate();
+}
+
+void JTrueSheetMetrics::recordDetentReconfiguration(jni::alias_ref<jclass>) {
+  TrueSheetMetrics::shared().recordDetentReconfiguration();
+}
+
+void JTrueSheetMetrics::recordPropTransaction(jni::alias_ref<jclass>, jint stages) {
+  TrueSheetMetrics::shared().recordPropTransaction(static_cast<uint64_t>(stages));
+}
+
+jni::local_ref<WritableNativeMap::jhybridobject> JTrueSheetMetrics::getSnapshot(jni::alias_ref<jclass>) {
+  return WritableNativeMap::createWithContents(TrueSheetMetrics::shared().snapshot().getDynamic());
+}
+
+void JTrueSheetMetrics::reset(jni::alias_ref<jclass>) {
+  TrueSheetMetrics::shared().reset();
+}
+
+} // namespace facebook::react
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include <react/jni/WritableNativeMap.h>
+
+namespace facebook::react {
+
+/*
+ * Static natives of `com.lodev09.truesheet.core.TrueSheetMetrics`, forwarding to the
+ * shared collector.
+ */
+class JTrueSheetMetrics : public jni::JavaClass<JTrueSheetMetrics> {
+ public:
+  static constexpr auto kJavaDescriptor = "Lcom/lodev09/truesheet/core/TrueSheetMetrics;";
+
+  static void registerNatives();
+
+ private:
+  static void recordPresentLatency(jni::alias_ref<jclass>, double ms);
+  static void recordDismissLatency(jni::alias_ref<jclass>, double ms);
+  static void recordPositionEmitted(jni::alias_ref<jclass>);
+  static void recordPositionCoalesced(jni::alias_ref<jclass>);
+  static void recordStateUpdate(jni::alias_ref<jclass>);
+  static void recordDetentReconfiguration(jni::alias_ref<jclass>);
+  static void recordPropTransaction(jni::alias_ref<jclass>, jint stages);
+  static jni::local_ref<WritableNativeMap::jhybridobject> getSnapshot(jni::alias_ref<jclass>);
+  static void reset(jni::alias_ref<jclass>);
+};
+
+} // namespace facebook::react
@@ -0,0 +1,73 @@
+#include "JTrueSheetModule.h"
+
+#include <algorithm>
+
+#include <react/renderer/components/TrueSheetSpec/TrueSheetCommandQueue.h>
+#include <react/renderer/components/TrueSheetSpec/TrueSheetCommandQueueHostObject.h>
+#include <react/renderer/components/TrueSheetSpec/TrueSheetPositionChannelHostObject.h>
+
+namespace facebook::react {
+
+void JTrueSheetModule::registerNatives() {
+  javaClassStatic()->registerNatives({
+    makeNativeMethod("getBindingsInstallerCxx", JTrueSheetModule::getBindingsInstallerCxx),
+    makeNativeMethod("drainCommandsCxx", JTrueSheetModule::drainCommandsCxx),
+    makeNativeMethod("failCommandCxx", JTrueSheetModule::failCommandCxx),
+  });
+}
+
+jni::local_ref<BindingsInstallerHolder::javaobject> JTrueSheetModule::getBindingsInstallerCxx(
+  jni::alias_ref<JTrueSheetModule> self) {
+  auto module = jni::make_global(self);
+  return BindingsInstallerHolder::newObjectCxxArgs(
+    [module](jsi::Runtime &runtime, const std::shared_ptr<CallInvoker> &callInvoker) {
+      TrueSheetPositionChannelHostObject::install(runtime);
+      TrueSheetCommandQueueHostObject::install(runtime, callInvoker);
+
+      // Runs on the JS thread, which is attached to the JVM
+      TrueSheetCommandQueue::setScheduler([module]() {
+        static const auto scheduleCommandDrain =
+          JTrueSheetModule::javaClassStatic()->getMethod<void()>("scheduleCommandDrain");
+        scheduleCommandDrain(module);
+      });
+    });
+}
+
+jni::local_ref<jni::JArrayInt> JTrueSheetModule::drainCommandsCxx(
+  jni::alias_ref<JTrueSheetModule>,
+  jni::alias_ref<jni::JArrayInt> presentedTags) {
+  auto presented = presentedTags->getRegion(0, presentedTags->size());
+  auto presentedEnd = presented.get() + presentedTags->size();
+  auto commands = TrueSheetCommandQueue::drain([&](int32_t tag) {
+    return std::find(presented.get(), presentedEnd, tag) != presentedEnd;
+  });
+  auto array = jni::JArrayInt::newArray(commands.size() * kCommandStride);
+  auto elements = array->pin();
+
+  size_t offset = 0;
+  for (const auto &command : commands) {
+    elements[offset] = command.tag;
+    elements[offset + 1] = static_cast<jint>(command.type);
+    elements[offset + 2] = command.index;
+    elements[offset + 3] = command.animated ? 1 : 0;
+    elements[offset + 4] = command.id;
+    elements[offset + 5] = command.superseded ? 1 : 0;
+    elements[offset + 6] = command.owner;
+    offset += kCommandStride;
+  }
+
+  return array;
+}
+
+void JTrueSheetModule::failCommandCxx(
+  jni::alias_ref<JTrueSheetModule>,
+  jint owner,
+  jint commandId,
+  jni::alias_ref<jni::JString> error) {
+  TrueSheetCommand command;
+  command.owner = owner;
+  command.id = commandId;
+  TrueSheetCommandQueue::fail(command, error->toStdString());
+}
+
+} // namespace facebook::react
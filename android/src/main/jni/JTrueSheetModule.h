@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ReactCommon/BindingsInstallerHolder.h>
+#include <fbjni/fbjni.h>
+
+namespace facebook::react {
+
+/*
+ * Native half of `com.lodev09.truesheet.TrueSheetModule`. Provides the JSI bindings
+ * installed into the JS runtime alongside the TurboModule, and drains the command queue
+ * those bindings fill.
+ */
+class JTrueSheetModule : public jni::JavaClass<JTrueSheetModule> {
+ public:
+  static constexpr auto kJavaDescriptor = "Lcom/lodev09/truesheet/TrueSheetModule;";
+
+  static void registerNatives();
+
+ private:
+  /*
+   * Ints per drained command: tag, type, index, animated, id, superseded, owner.
+   * Matches `TrueSheetModule.COMMAND_STRIDE`.
+   */
+  static constexpr size_t kCommandStride = 7;
+
+  static jni::local_ref<BindingsInstallerHolder::javaobject> getBindingsInstallerCxx(
+    jni::alias_ref<JTrueSheetModule> self);
+
+  static jni::local_ref<jni::JArrayInt> drainCommandsCxx(
+    jni::alias_ref<JTrueSheetModule>,
+    jni::alias_ref<jni::JArrayInt> presentedTags);
+
+  static void failCommandCxx(
+    jni::alias_ref<JTrueSheetModule>,
+    jint owner,
+    jint commandId,
+    jni::alias_ref<jni::JString> error);
+};
+
+} // namespace facebook::react
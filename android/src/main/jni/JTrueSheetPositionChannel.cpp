@@ -0,0 +1,31 @@
+#include "JTrueSheetPositionChannel.h"
+
+namespace facebook::react {
+
+jni::local_ref<JTrueSheetPositionChannel::jhybriddata> JTrueSheetPositionChannel::initHybrid(jni::alias_ref<jclass>) {
+  return makeCxxInstance();
+}
+
+void JTrueSheetPositionChannel::registerNatives() {
+  registerHybrid({
+    makeNativeMethod("initHybrid", JTrueSheetPositionChannel::initHybrid),
+    makeNativeMethod("registerTag", JTrueSheetPositionChannel::registerTag),
+    makeNativeMethod("unregisterTag", JTrueSheetPositionChannel::unregisterTag),
+    makeNativeMethod("write", JTrueSheetPositionChannel::write),
+  });
+}
+
+void JTrueSheetPositionChannel::registerTag(jint tag) {
+  TrueSheetPositionChannelRegistry::registerChannel(tag, channel_);
+}
+
+void JTrueSheetPositionChannel::unregisterTag(jint tag) {
+  TrueSheetPositionChannelRegistry::unregisterChannel(tag);
+}
+
+void JTrueSheetPositionChannel::write(
+    double index, double position, double detent, double timestamp, jboolean realtime) {
+  channel_->write({index, position, detent, timestamp, static_cast<bool>(realtime)});
+}
+
+} // namespace facebook::react
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include <react/renderer/components/TrueSheetSpec/TrueSheetPositionChannel.h>
+
+#include <memory>
+
+namespace facebook::react {
+
+/*
+ * fbjni hybrid backing `com.lodev09.truesheet.core.TrueSheetPositionChannel`.
+ */
+class JTrueSheetPositionChannel : public jni::HybridClass<JTrueSheetPositionChannel> {
+ public:
+  static constexpr auto kJavaDescriptor = "Lcom/lodev09/truesheet/core/TrueSheetPositionChannel;";
+
+  static jni::local_ref<jhybriddata> initHybrid(jni::alias_ref<jclass>);
+
+  static void registerNatives();
+
+ private:
+  friend HybridBase;
+
+  JTrueSheetPositionChannel() : channel_(std::make_shared<TrueSheetPositionChannel>()) {}
+
+  void registerTag(jint tag);
+  void unregisterTag(jint tag);
+  void write(double index, double position, double detent, double timestamp, jboolean realtime);
+
+  std::shared_ptr<TrueSheetPositionChannel> channel_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,34 @@
+#include "JTrueSheetPositionSampler.h"
+
+namespace facebook::react {
+
+jni::local_ref<JTrueSheetPositionSampler::jhybriddata> JTrueSheetPositionSampler::initHybrid(jni::alias_ref<jclass>) {
+  return makeCxxInstance();
+}
+
+void JTrueSheetPositionSampler::registerNatives() {
+  registerHybrid({
+    makeNativeMethod("initHybrid", JTrueSheetPositionSampler::initHybrid),
+    makeNativeMethod("nativeSetPolicy", JTrueSheetPositionSampler::setPolicy),
+    makeNativeMethod("nativeShouldEmit", JTrueSheetPositionSampler::shouldEmit),
+    makeNativeMethod("reset", JTrueSheetPositionSampler::reset),
+  });
+}
+
+void JTrueSheetPositionSampler::setPolicy(jboolean settledOnly, double maxHz, double minDelta) {
+  TrueSheetPositionPolicy policy;
+  policy.settledOnly = settledOnly;
+  policy.maxHz = maxHz;
+  policy.minDelta = minDelta;
+  sampler_.setPolicy(policy);
+}
+
+jboolean JTrueSheetPositionSampler::shouldEmit(double position, jboolean realtime, double timestamp) {
+  return sampler_.shouldEmit(position, realtime, timestamp);
+}
+
+void JTrueSheetPositionSampler::reset() {
+  sampler_.reset();
+}
+
+} // namespace facebook::react
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include <react/renderer/components/TrueSheetSpec/TrueSheetPositionSampler.h>
+
+namespace facebook::react {
+
+/*
+ * fbjni hybrid backing `com.lodev09.truesheet.core.TrueSheetPositionSampler`.
+ */
+class JTrueSheetPositionSampler : public jni::HybridClass<JTrueSheetPositionSampler> {
+ public:
+  static constexpr auto kJavaDescriptor = "Lcom/lodev09/truesheet/core/TrueSheetPositionSampler;";
+
+  static jni::local_ref<jhybriddata> initHybrid(jni::alias_ref<jclass>);
+
+  static void registerNatives();
+
+ private:
+  friend HybridBase;
+
+  JTrueSheetPositionSampler() = default;
+
+  void setPolicy(jboolean settledOnly, double maxHz, double minDelta);
+  jboolean shouldEmit(double position, jboolean realtime, double timestamp);
+  void reset();
+
+  TrueSheetPositionSampler sampler_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,19 @@
+#include <fbjni/fbjni.h>
+
+#include "JTrueSheetDetentEngine.h"
+#include "JTrueSheetLayoutRegistry.h"
+#include "JTrueSheetMetrics.h"
+#include "JTrueSheetModule.h"
+#include "JTrueSheetPositionChannel.h"
+#include "JTrueSheetPositionSampler.h"
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *) {
+  return facebook::jni::initialize(vm, [] {
+    facebook::react::JTrueSheetDetentEngine::registerNatives();
+    facebook::react::JTrueSheetPositionChannel::registerNatives();
+    facebook::react::JTrueSheetPositionSampler::registerNatives();
+    facebook::react::JTrueSheetModule::registerNatives();
+    facebook::react::JTrueSheetMetrics::registerNatives();
+    facebook::react::JTrueSheetLayoutRegistry::registerNatives();
+  });
+}
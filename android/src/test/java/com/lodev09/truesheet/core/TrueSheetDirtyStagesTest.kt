@@ -0,0 +1,129 @@
+package com.lodev09.truesheet.core
+
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_BACKGROUND
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_DETENTS
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_GRABBER
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.Companion.STAGE_SCROLLABLE
+import com.lodev09.truesheet.core.TrueSheetDirtyStages.PropStages
+import org.junit.Assert.assertEquals
+import org.junit.Before
+import org.junit.Test
+
+class TrueSheetDirtyStagesTest {
+
+  /**
+   * A subset of the sheet props, set the way `TrueSheetView` setters set them, with the same
+   * [PropStages] mapping.
+   */
+  private class Props(val dirtyStages: TrueSheetDirtyStages) {
+    var sheetBackgroundColor: Int? = null
+    var sheetCornerRadius = 0f
+    var hasGrabber = true
+    var sheetDetents: MutableList<Double> = mutableListOf(0.5, 1.0)
+    var scrollEnabled = false
+    var applied = 0
+
+    fun setBackgroundColor(color: Int?) {
+      dirtyStages.update(sheetBackgroundColor, color, PropStages.BACKGROUND_COLOR) {
+        sheetBackgroundColor = it
+        applied++
+      }
+    }
+
+    fun setCornerRadius(radius: Float) {
+      dirtyStages.update(sheetCornerRadius, radius, PropStages.CORNER_RADIUS) {
+        sheetCornerRadius = it
+        applied++
+      }
+    }
+
+    fun setGrabber(grabber: Boolean) {
+      dirtyStages.update(hasGrabber, grabber, PropStages.GRABBER) {
+        hasGrabber = it
+        applied++
+      }
+    }
+
+    fun setDetents(detents: MutableList<Double>) {
+      dirtyStages.update(sheetDetents, detents, PropStages.DETENTS) {
+        sheetDetents = it
+        applied++
+      }
+    }
+
+    fun setScrollable(scrollable: Boolean) {
+      dirtyStages.update(scrollEnabled, scrollable, PropStages.SCROLLABLE) {
+        scrollEnabled = it
+        applied++
+      }
+    }
+
+    // Sets every prop, changed or not
+    fun transaction(backgroundColor: Int?, grabber: Boolean, detents: List<Double>, scrollable: Boolean) {
+      setBackgroundColor(backgroundColor)
+      setGrabber(grabber)
+      setDetents(detents.toMutableList())
+      setScrollable(scrollable)
+    }
+  }
+
+  private lateinit var dirtyStages: TrueSheetDirtyStages
+  private lateinit var props: Props
+
+  @Before
+  fun setUp() {
+    dirtyStages = TrueSheetDirtyStages()
+    props = Props(dirtyStages)
+    props.transaction(RED, true, listOf(0.5, 1.0), false)
+    dirtyStages.take()
+    props.applied = 0
+  }
+
+  @Test
+  fun unchangedPropsSkipEveryStage() {
+    props.transaction(RED, true, listOf(0.5, 1.0), false)
+
+    assertEquals(0, dirtyStages.take())
+    assertEquals(0, props.applied)
+  }
+
+  @Test
+  fun backgroundColorChangeRunsOnlyTheBackgroundStage() {
+    props.transaction(BLUE, true, listOf(0.5, 1.0), false)
+
+    assertEquals(STAGE_BACKGROUND, dirtyStages.take())
+    assertEquals(1, props.applied)
+  }
+
+  @Test
+  fun stagesMarkedTwiceRunOnce() {
+    props.setBackgroundColor(BLUE)
+    props.setCornerRadius(CORNER_RADIUS)
+
+    assertEquals(STAGE_BACKGROUND, dirtyStages.take())
+    assertEquals(2, props.applied)
+  }
+
+  @Test
+  fun scrollableSkipsTheDetentsStage() {
+    props.setScrollable(true)
+    assertEquals(STAGE_SCROLLABLE, dirtyStages.take())
+
+    props.transaction(RED, true, listOf(0.25, 1.0), false)
+    assertEquals(STAGE_SCROLLABLE or STAGE_DETENTS, dirtyStages.take())
+  }
+
+  @Test
+  fun takeClearsTheStages() {
+    props.setGrabber(false)
+
+    assertEquals(STAGE_GRABBER, dirtyStages.take())
+    assertEquals(0, dirtyStages.take())
+  }
+
+  companion object {
+    private const val RED = 0xFFFF0000.toInt()
+    private const val BLUE = 0xFF0000FF.toInt()
+    private const val CORNER_RADIUS = 16f
+  }
+}
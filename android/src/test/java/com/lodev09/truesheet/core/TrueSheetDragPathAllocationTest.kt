@@ -0,0 +1,112 @@
+package com.lodev09.truesheet.core
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Assume.assumeTrue
+import org.junit.Before
+import org.junit.Test
+import java.lang.management.ManagementFactory
+
+/**
+ * Runs the Kotlin side of a drag, one slide callback per frame, and checks it doesn't allocate.
+ * The detent segment lookup runs in the native engine, which can't load on the JVM, so its
+ * allocations are checked by the host C++ tests (`TrueSheetDetentEngine.DragLookupsDoNotAllocate`).
+ */
+class TrueSheetDragPathAllocationTest {
+
+  /**
+   * Keeps the last dispatched values in primitives. JS drains every other frame.
+   */
+  private class FakeDelegate : TrueSheetEventCoalescerDelegate {
+    var positionSequence = 0
+    var dragSequence = 0
+    var dropped = 0
+    var pendingDrain: Runnable? = null
+
+    override fun coalescerDispatchPositionChange(
+      index: Float,
+      position: Float,
+      detent: Float,
+      realtime: Boolean,
+      sequence: Int,
+      timestamp: Double
+    ) {
+      positionSequence = sequence
+    }
+
+    override fun coalescerDispatchDragChange(index: Int, position: Float, detent: Float, sequence: Int, timestamp: Double) {
+      dragSequence = sequence
+    }
+
+    override fun coalescerDidDropPositionChange() {
+      dropped++
+    }
+
+    override fun coalescerAwaitDrain(callback: Runnable) {
+      pendingDrain = callback
+    }
+
+    fun drain() {
+      val drain = pendingDrain ?: return
+      pendingDrain = null
+      drain.run()
+    }
+  }
+
+  private val threadBean = ManagementFactory.getThreadMXBean() as com.sun.management.ThreadMXBean
+  private lateinit var delegate: FakeDelegate
+  private lateinit var coalescer: TrueSheetEventCoalescer
+  private var alphaSum = 0f
+
+  @Before
+  fun setUp() {
+    assumeTrue(threadBean.isThreadAllocatedMemorySupported)
+    threadBean.isThreadAllocatedMemoryEnabled = true
+
+    delegate = FakeDelegate()
+    coalescer = TrueSheetEventCoalescer()
+    coalescer.delegate = delegate
+  }
+
+  /**
+   * What the slide callback does per frame once the detent lookup returned.
+   */
+  private fun slide(frame: Int) {
+    val sheetTop = SCREEN_HEIGHT - frame % SCREEN_HEIGHT
+    val timestamp = frame * FRAME_MS
+
+    alphaSum += TrueSheetDimView.calculateAlpha(sheetTop, DIMMED_DETENT_TOP, BELOW_DIMMED_TOP)
+    coalescer.offerPositionChange(frame / 100f, sheetTop.toFloat(), 0.5f, true, timestamp)
+    coalescer.offerDragChange(frame % 3, sheetTop.toFloat(), 0.5f, timestamp)
+    if (frame % 2 == 0) delegate.drain()
+  }
+
+  private fun allocatedBytes(): Long = threadBean.getThreadAllocatedBytes(Thread.currentThread().id)
+
+  @Test
+  fun dragFramesDoNotAllocate() {
+    // Warm up class loading and the interpreter's first-call paths
+    repeat(FRAMES) { slide(it) }
+    allocatedBytes()
+
+    val before = allocatedBytes()
+    for (frame in FRAMES until FRAMES * 2) {
+      slide(frame)
+    }
+    val allocated = allocatedBytes() - before
+    coalescer.flush()
+
+    assertEquals(0L, allocated)
+    assertTrue(alphaSum > 0f)
+    assertTrue(delegate.dropped > 0)
+    assertEquals(FRAMES * 2, delegate.dragSequence)
+  }
+
+  companion object {
+    private const val FRAMES = 10_000
+    private const val FRAME_MS = 16.0
+    private const val SCREEN_HEIGHT = 2000
+    private const val DIMMED_DETENT_TOP = 800
+    private const val BELOW_DIMMED_TOP = 1400
+  }
+}
@@ -0,0 +1,141 @@
+package com.lodev09.truesheet.core
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+
+class TrueSheetDrainSignalTest {
+
+  /**
+   * Queues tasks per thread, run by the test in the order the threads would run them.
+   */
+  private class FakeDelegate : TrueSheetDrainSignalDelegate {
+    val jsQueue = mutableListOf<Runnable>()
+    val uiQueue = mutableListOf<Runnable>()
+
+    override fun drainSignalRunOnJSQueue(task: Runnable) {
+      jsQueue += task
+    }
+
+    override fun drainSignalRunOnUiThread(task: Runnable) {
+      uiQueue += task
+    }
+
+    fun runJS() = run(jsQueue)
+
+    fun runUi() = run(uiQueue)
+
+    private fun run(queue: MutableList<Runnable>) {
+      val tasks = queue.toList()
+      queue.clear()
+      tasks.forEach { it.run() }
+    }
+  }
+
+  private lateinit var delegate: FakeDelegate
+  private lateinit var signal: TrueSheetDrainSignal
+  private var drains = 0
+  private val callback = Runnable { drains++ }
+
+  @Before
+  fun setUp() {
+    delegate = FakeDelegate()
+    signal = TrueSheetDrainSignal()
+    signal.delegate = delegate
+    drains = 0
+  }
+
+  @Test
+  fun drainWaitsForTheEventBeat() {
+    signal.await(callback)
+
+    // Nothing reaches JS before the beat schedules the flush
+    delegate.runJS()
+    delegate.runUi()
+    assertTrue(delegate.jsQueue.isEmpty())
+    assertEquals(0, drains)
+
+    signal.onBatchEventDispatched()
+    delegate.runUi()
+    assertEquals(0, drains)
+
+    delegate.runJS()
+    delegate.runUi()
+    assertEquals(1, drains)
+  }
+
+  @Test
+  fun batchesWithoutAPendingDrainAreIgnored() {
+    signal.onBatchEventDispatched()
+    assertTrue(delegate.jsQueue.isEmpty())
+
+    signal.await(callback)
+    signal.onBatchEventDispatched()
+    signal.onBatchEventDispatched()
+    assertEquals(1, delegate.jsQueue.size)
+  }
+
+  @Test
+  fun callbackRunsOncePerDrain() {
+    signal.await(callback)
+    signal.onBatchEventDispatched()
+    delegate.runJS()
+    delegate.runUi()
+
+    signal.onBatchEventDispatched()
+    delegate.runJS()
+    delegate.runUi()
+    assertEquals(1, drains)
+  }
+
+  @Test
+  fun cancelDropsThePendingDrain() {
+    signal.await(callback)
+    signal.onBatchEventDispatched()
+    signal.cancel()
+
+    delegate.runJS()
+    delegate.runUi()
+    assertEquals(0, drains)
+  }
+
+  /**
+   * With the coalescer, samples offered while the drain is pending wait for the beat.
+   */
+  @Test
+  fun coalescerDispatchesAfterTheDrain() {
+    var dispatched = 0
+    val coalescer = TrueSheetEventCoalescer()
+    coalescer.delegate = object : TrueSheetEventCoalescerDelegate {
+      override fun coalescerDispatchPositionChange(
+        index: Float,
+        position: Float,
+        detent: Float,
+        realtime: Boolean,
+        sequence: Int,
+        timestamp: Double
+      ) {
+        dispatched++
+      }
+
+      override fun coalescerDispatchDragChange(index: Int, position: Float, detent: Float, sequence: Int, timestamp: Double) {}
+
+      override fun coalescerDidDropPositionChange() {}
+
+      override fun coalescerAwaitDrain(callback: Runnable) {
+        signal.await(callback)
+      }
+    }
+
+    coalescer.offerPositionChange(0f, 100f, 0.5f, true, 0.0)
+    coalescer.offerPositionChange(0f, 110f, 0.5f, true, 16.0)
+    coalescer.offerPositionChange(0f, 120f, 0.5f, true, 32.0)
+    assertEquals(1, dispatched)
+
+    signal.onBatchEventDispatched()
+    delegate.runJS()
+    delegate.runUi()
+    assertEquals(2, dispatched)
+  }
+}
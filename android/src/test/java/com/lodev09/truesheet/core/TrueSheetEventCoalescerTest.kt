@@ -0,0 +1,147 @@
+package com.lodev09.truesheet.core
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+
+class TrueSheetEventCoalescerTest {
+
+  private data class Sample(val kind: String, val position: Float, val sequence: Int)
+
+  /**
+   * Records dispatched samples. JS is "busy" until [drain] runs the pending drain callbacks.
+   */
+  private class FakeDelegate : TrueSheetEventCoalescerDelegate {
+    val dispatched = mutableListOf<Sample>()
+    val pendingDrains = mutableListOf<Runnable>()
+    var dropped = 0
+
+    override fun coalescerDispatchPositionChange(
+      index: Float,
+      position: Float,
+      detent: Float,
+      realtime: Boolean,
+      sequence: Int,
+      timestamp: Double
+    ) {
+      dispatched += Sample(POSITION, position, sequence)
+    }
+
+    override fun coalescerDispatchDragChange(index: Int, position: Float, detent: Float, sequence: Int, timestamp: Double) {
+      dispatched += Sample(DRAG, position, sequence)
+    }
+
+    override fun coalescerDidDropPositionChange() {
+      dropped++
+    }
+
+    override fun coalescerAwaitDrain(callback: Runnable) {
+      pendingDrains += callback
+    }
+
+    fun drain() {
+      val drains = pendingDrains.toList()
+      pendingDrains.clear()
+      drains.forEach { it.run() }
+    }
+  }
+
+  private lateinit var delegate: FakeDelegate
+  private lateinit var coalescer: TrueSheetEventCoalescer
+
+  @Before
+  fun setUp() {
+    delegate = FakeDelegate()
+    coalescer = TrueSheetEventCoalescer()
+    coalescer.delegate = delegate
+  }
+
+  private fun slide(frame: Int) {
+    val position = frame.toFloat()
+    coalescer.offerPositionChange(0.5f, position, 0.5f, true, frame.toDouble())
+    coalescer.offerDragChange(0, position, 0.5f, frame.toDouble())
+  }
+
+  @Test
+  fun floodWhileJsIsBusyQueuesOneSamplePerKind() {
+    for (frame in 1..SLIDE_COUNT) {
+      slide(frame)
+      assertTrue(delegate.dispatched.size <= 2)
+    }
+
+    // The first position goes out right away, everything after waits for JS
+    assertEquals(listOf(Sample(POSITION, 1f, 1)), delegate.dispatched)
+    assertEquals(1, delegate.pendingDrains.size)
+    assertEquals(SLIDE_COUNT - 2, delegate.dropped)
+  }
+
+  @Test
+  fun drainDeliversNewestSample() {
+    for (frame in 1..SLIDE_COUNT) slide(frame)
+    delegate.dispatched.clear()
+
+    delegate.drain()
+
+    val last = SLIDE_COUNT.toFloat()
+    assertEquals(listOf(Sample(POSITION, last, SLIDE_COUNT), Sample(DRAG, last, SLIDE_COUNT)), delegate.dispatched)
+  }
+
+  @Test
+  fun periodicDrainsBoundQueuedEvents() {
+    var drains = 0
+    for (frame in 1..SLIDE_COUNT) {
+      slide(frame)
+      if (frame % FRAMES_PER_DRAIN == 0) {
+        delegate.drain()
+        drains++
+      }
+    }
+    delegate.drain()
+
+    val positions = delegate.dispatched.filter { it.kind == POSITION }
+    val drags = delegate.dispatched.filter { it.kind == DRAG }
+    assertTrue(positions.size <= drains + 2)
+    assertTrue(drags.size <= drains + 2)
+
+    // Sequences only move forward and the newest sample always arrives
+    for (samples in listOf(positions, drags)) {
+      samples.zipWithNext { a, b -> assertTrue(b.sequence > a.sequence) }
+      assertEquals(SLIDE_COUNT, samples.last().sequence)
+    }
+  }
+
+  @Test
+  fun settlePositionSkipsTheDrainWait() {
+    slide(1)
+    slide(2)
+    delegate.dispatched.clear()
+
+    coalescer.offerPositionChange(1f, 3f, 1f, false, 3.0)
+
+    // The pending drag sample goes out with the settle position
+    assertEquals(listOf(Sample(POSITION, 3f, 3), Sample(DRAG, 2f, 2)), delegate.dispatched)
+  }
+
+  @Test
+  fun flushDispatchesPendingSamplesBeforeDiscreteEvents() {
+    slide(1)
+    slide(2)
+    delegate.dispatched.clear()
+
+    coalescer.flush()
+    assertEquals(listOf(Sample(POSITION, 2f, 2), Sample(DRAG, 2f, 2)), delegate.dispatched)
+
+    // Nothing is left to deliver once JS catches up
+    delegate.dispatched.clear()
+    delegate.drain()
+    assertTrue(delegate.dispatched.isEmpty())
+  }
+
+  companion object {
+    private const val SLIDE_COUNT = 10_000
+    private const val FRAMES_PER_DRAIN = 16
+    private const val POSITION = "position"
+    private const val DRAG = "drag"
+  }
+}
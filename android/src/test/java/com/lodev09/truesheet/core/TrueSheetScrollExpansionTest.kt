@@ -0,0 +1,93 @@
+package com.lodev09.truesheet.core
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+
+class TrueSheetScrollExpansionTest {
+
+  /**
+   * Counts layout passes the way the scroll view would: every padding change requests one.
+   */
+  private class FakeScrollView : TrueSheetScrollExpansionDelegate {
+    var requestLayoutCount = 0
+    val clamps = mutableListOf<Int>()
+
+    override fun scrollExpansionApplyPadding(padding: Int) {
+      requestLayoutCount++
+    }
+
+    override fun scrollExpansionClampScroll(padding: Int) {
+      clamps += padding
+    }
+  }
+
+  private lateinit var scrollView: FakeScrollView
+  private lateinit var scrollExpansion: TrueSheetScrollExpansion
+
+  @Before
+  fun setUp() {
+    scrollView = FakeScrollView()
+    scrollExpansion = TrueSheetScrollExpansion()
+    scrollExpansion.delegate = scrollView
+
+    // Sheet settled at the collapsed detent
+    scrollExpansion.update(COLLAPSED_PADDING, isSheetMoving = false)
+    scrollView.requestLayoutCount = 0
+  }
+
+  // Padding for each frame of a drag from the collapsed detent up to expanded and back
+  private fun dragPadding(frame: Int): Int {
+    val half = DRAG_FRAMES / 2
+    val progress = if (frame < half) frame.toFloat() / half else (DRAG_FRAMES - frame).toFloat() / half
+    return (COLLAPSED_PADDING * (1 - progress)).toInt()
+  }
+
+  @Test
+  fun dragRequestsNoLayoutUntilSettle() {
+    for (frame in 0 until DRAG_FRAMES) {
+      scrollExpansion.update(dragPadding(frame), isSheetMoving = true)
+    }
+    assertEquals(0, scrollView.requestLayoutCount)
+
+    scrollExpansion.update(0, isSheetMoving = false)
+    assertEquals(1, scrollView.requestLayoutCount)
+    assertEquals(0, scrollExpansion.padding)
+  }
+
+  @Test
+  fun dragBackToTheSameDetentRequestsNoLayout() {
+    for (frame in 0 until DRAG_FRAMES) {
+      scrollExpansion.update(dragPadding(frame), isSheetMoving = true)
+    }
+    scrollExpansion.update(COLLAPSED_PADDING, isSheetMoving = false)
+
+    assertEquals(0, scrollView.requestLayoutCount)
+  }
+
+  @Test
+  fun dragClampsOnlyWhilePaddingShrinks() {
+    for (frame in 0 until DRAG_FRAMES) {
+      scrollExpansion.update(dragPadding(frame), isSheetMoving = true)
+    }
+
+    assertTrue(scrollView.clamps.isNotEmpty())
+    assertTrue(scrollView.clamps.all { it < COLLAPSED_PADDING })
+  }
+
+  @Test
+  fun slidesOutsideADragApplyEveryChange() {
+    for (frame in 0 until DRAG_FRAMES) {
+      scrollExpansion.update(COLLAPSED_PADDING - frame - 1, isSheetMoving = false)
+    }
+
+    assertEquals(DRAG_FRAMES, scrollView.requestLayoutCount)
+    assertTrue(scrollView.clamps.isEmpty())
+  }
+
+  companion object {
+    private const val DRAG_FRAMES = 120
+    private const val COLLAPSED_PADDING = 600
+  }
+}
@@ -0,0 +1,96 @@
+package com.lodev09.truesheet.core
+
+import com.google.android.material.bottomsheet.BottomSheetBehavior.STATE_COLLAPSED
+import com.google.android.material.bottomsheet.BottomSheetBehavior.STATE_EXPANDED
+import com.google.android.material.bottomsheet.BottomSheetBehavior.STATE_HALF_EXPANDED
+import com.google.android.material.bottomsheet.BottomSheetBehavior.STATE_HIDDEN
+import org.junit.Assert.assertEquals
+import org.junit.Test
+
+class TrueSheetSettlePredictorTest {
+
+  private val offsets = TrueSheetSettleOffsets(
+    parentHeight = 2000,
+    expandedOffset = 200,
+    halfExpandedOffset = 1000,
+    collapsedOffset = 1600,
+    peekHeight = 400
+  )
+
+  // Two detents sized to their content: expanded sits at the sheet's own top
+  private val fitOffsets = offsets.copy(expandedOffset = 1000)
+
+  private fun predict(
+    top: Int,
+    yVelocity: Float,
+    xVelocity: Float = 0f,
+    hideable: Boolean = false,
+    fitToContents: Boolean = false
+  ): Int = TrueSheetSettlePredictor.predictState(
+    top = top,
+    xVelocity = xVelocity,
+    yVelocity = yVelocity,
+    offsets = if (fitToContents) fitOffsets else offsets,
+    fitToContents = fitToContents,
+    hideable = hideable,
+    significantVelocity = SIGNIFICANT_VELOCITY
+  )
+
+  @Test
+  fun releaseAtRestSettlesAtTheNearestState() {
+    assertEquals(STATE_HALF_EXPANDED, predict(top = 1250, yVelocity = 0f))
+    assertEquals(STATE_COLLAPSED, predict(top = 1450, yVelocity = 0f))
+    assertEquals(STATE_EXPANDED, predict(top = 300, yVelocity = 0f))
+
+    // Above half-expanded, Material measures the expanded distance from the parent's top
+    assertEquals(STATE_HALF_EXPANDED, predict(top = 800, yVelocity = 0f))
+  }
+
+  @Test
+  fun mostlyHorizontalReleaseSettlesAtTheNearestState() {
+    assertEquals(STATE_COLLAPSED, predict(top = 1450, yVelocity = 1000f, xVelocity = 3000f))
+    assertEquals(STATE_HALF_EXPANDED, predict(top = 1250, yVelocity = 1000f, xVelocity = -3000f))
+  }
+
+  @Test
+  fun upwardFlingMovesToTheNextStateUp() {
+    assertEquals(STATE_HALF_EXPANDED, predict(top = 1500, yVelocity = -100f))
+    assertEquals(STATE_EXPANDED, predict(top = 900, yVelocity = -100f))
+
+    // Checked before the horizontal rule
+    assertEquals(STATE_HALF_EXPANDED, predict(top = 1500, yVelocity = -100f, xVelocity = 3000f))
+  }
+
+  @Test
+  fun downwardFlingPicksTheNearerOfHalfExpandedAndCollapsed() {
+    assertEquals(STATE_HALF_EXPANDED, predict(top = 300, yVelocity = 800f))
+    assertEquals(STATE_COLLAPSED, predict(top = 1400, yVelocity = 800f))
+  }
+
+  @Test
+  fun hidesThroughHideFriction() {
+    // Friction keeps a slow release near collapsed
+    assertEquals(STATE_COLLAPSED, predict(top = 1600, yVelocity = 600f, hideable = true))
+    assertEquals(STATE_HIDDEN, predict(top = 1600, yVelocity = 3000f, hideable = true))
+
+    // Released low at rest
+    assertEquals(STATE_COLLAPSED, predict(top = 1700, yVelocity = 0f, hideable = true))
+    assertEquals(STATE_HIDDEN, predict(top = 1850, yVelocity = 0f, hideable = true))
+
+    // Above collapsed it never hides
+    assertEquals(STATE_COLLAPSED, predict(top = 1500, yVelocity = 8000f, hideable = true))
+    assertEquals(STATE_COLLAPSED, predict(top = 1600, yVelocity = 3000f))
+  }
+
+  @Test
+  fun fitToContentsHasNoHalfExpandedState() {
+    assertEquals(STATE_EXPANDED, predict(top = 1500, yVelocity = -100f, fitToContents = true))
+    assertEquals(STATE_COLLAPSED, predict(top = 1100, yVelocity = 800f, fitToContents = true))
+    assertEquals(STATE_EXPANDED, predict(top = 1250, yVelocity = 0f, fitToContents = true))
+    assertEquals(STATE_COLLAPSED, predict(top = 1350, yVelocity = 0f, fitToContents = true))
+  }
+
+  companion object {
+    private const val SIGNIFICANT_VELOCITY = 500
+  }
+}
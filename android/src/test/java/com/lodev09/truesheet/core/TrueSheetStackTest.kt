@@ -0,0 +1,136 @@
+package com.lodev09.truesheet.core
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertNull
+import org.junit.Assert.assertSame
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+import kotlin.random.Random
+
+class TrueSheetStackTest {
+
+  private class FakeSheet(val id: Int) {
+    override fun toString() = "sheet$id"
+  }
+
+  private lateinit var stack: TrueSheetStack<String, FakeSheet>
+  private lateinit var sheets: List<FakeSheet>
+
+  @Before
+  fun setUp() {
+    stack = TrueSheetStack()
+    sheets = List(SHEET_COUNT) { FakeSheet(it) }
+  }
+
+  private fun containerFor(sheet: FakeSheet) = "container${sheet.id % CONTAINER_COUNT}"
+
+  /**
+   * Registers all sheets, round-robin across containers.
+   */
+  private fun registerAll() {
+    for (sheet in sheets) {
+      assertTrue(stack.register(sheet, containerFor(sheet)))
+    }
+  }
+
+  /**
+   * Checks every query against [expected], the stacks per container bottom to top.
+   */
+  private fun assertMatches(expected: Map<String, List<FakeSheet>>) {
+    assertEquals(expected.values.sumOf { it.size }, stack.size)
+    for ((container, containerSheets) in expected) {
+      containerSheets.forEachIndexed { index, sheet ->
+        assertEquals(container, stack.containerOf(sheet))
+        assertEquals(containerSheets.getOrNull(index - 1), stack.parentOf(sheet))
+        assertEquals(index == containerSheets.size - 1, stack.isTopmost(sheet))
+        assertEquals(containerSheets.subList(index + 1, containerSheets.size).reversed(), stack.sheetsAbove(sheet))
+        assertEquals(containerSheets.subList(index, containerSheets.size), stack.sheetsFrom(sheet))
+      }
+    }
+  }
+
+  @Test
+  fun stacksSheetsPerContainer() {
+    registerAll()
+
+    assertMatches(sheets.groupBy { containerFor(it) })
+    assertSame(sheets.last(), stack.findLast { true })
+  }
+
+  @Test
+  fun unregisterFromTheMiddleShiftsSheetsAbove() {
+    registerAll()
+
+    val removed = sheets.filter { it.id % 3 == 1 }
+    for (sheet in removed) {
+      assertTrue(stack.unregister(sheet))
+      assertFalse(stack.contains(sheet))
+      assertNull(stack.parentOf(sheet))
+      assertTrue(stack.sheetsAbove(sheet).isEmpty())
+    }
+
+    assertMatches((sheets - removed.toSet()).groupBy { containerFor(it) })
+  }
+
+  @Test
+  fun findLastFollowsRegistrationOrderAcrossContainers() {
+    registerAll()
+
+    // Only the topmost matching sheet of each container is checked
+    val bottomHalf = stack.findLast { it.id < SHEET_COUNT / 2 }
+    assertSame(sheets[SHEET_COUNT / 2 - 1], bottomHalf)
+
+    for (sheet in sheets.reversed()) {
+      assertSame(sheet, stack.findLast { true })
+      stack.unregister(sheet)
+    }
+    assertNull(stack.findLast { true })
+  }
+
+  @Test
+  fun registrationIsIdempotent() {
+    registerAll()
+
+    for (sheet in sheets) {
+      assertFalse(stack.register(sheet, "other"))
+    }
+    assertMatches(sheets.groupBy { containerFor(it) })
+
+    stack.clear()
+    assertEquals(0, stack.size)
+    assertFalse(stack.unregister(sheets.first()))
+    assertNull(stack.containerOf(sheets.first()))
+  }
+
+  /**
+   * Random registrations and removals, checked against a plain list per container.
+   */
+  @Test
+  fun randomOperationsMatchModel() {
+    val random = Random(SEED)
+    val model = LinkedHashMap<String, MutableList<FakeSheet>>()
+
+    repeat(OPERATION_COUNT) {
+      val sheet = sheets[random.nextInt(SHEET_COUNT)]
+      if (stack.contains(sheet)) {
+        stack.unregister(sheet)
+        model.values.forEach { it.remove(sheet) }
+      } else {
+        val container = "container${random.nextInt(CONTAINER_COUNT)}"
+        stack.register(sheet, container)
+        model.getOrPut(container) { mutableListOf() }.add(sheet)
+      }
+    }
+
+    assertMatches(model)
+  }
+
+  companion object {
+    private const val SHEET_COUNT = 50
+    private const val CONTAINER_COUNT = 4
+    private const val OPERATION_COUNT = 10_000
+    private const val SEED = 42
+  }
+}
@@ -0,0 +1,73 @@
+package com.lodev09.truesheet.events
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNotSame
+import org.junit.Assert.assertSame
+import org.junit.Test
+import java.util.Collections
+import java.util.IdentityHashMap
+
+class TrueSheetEventPoolTest {
+
+  private fun obtainPosition(viewId: Int, frame: Int) =
+    PositionChangeEvent.obtain(SURFACE_ID, viewId, 0.5f, frame.toFloat(), 0.5f, true, frame, frame.toDouble())
+
+  private fun obtainDrag(viewId: Int, frame: Int) =
+    DragChangeEvent.obtain(SURFACE_ID, viewId, 0, frame.toFloat(), 0.5f, frame, frame.toDouble())
+
+  @Test
+  fun disposedPositionEventIsReused() {
+    val first = obtainPosition(VIEW_ID, 1)
+    first.dispose()
+
+    val second = obtainPosition(OTHER_VIEW_ID, 2)
+    assertSame(first, second)
+    assertEquals(OTHER_VIEW_ID, second.viewTag)
+    second.dispose()
+  }
+
+  @Test
+  fun disposedDragEventIsReused() {
+    val first = obtainDrag(VIEW_ID, 1)
+    first.dispose()
+
+    val second = obtainDrag(OTHER_VIEW_ID, 2)
+    assertSame(first, second)
+    assertEquals(OTHER_VIEW_ID, second.viewTag)
+    second.dispose()
+  }
+
+  @Test
+  fun eventsInFlightAreNotShared() {
+    val first = obtainPosition(VIEW_ID, 1)
+    val second = obtainPosition(VIEW_ID, 2)
+    assertNotSame(first, second)
+
+    second.dispose()
+    first.dispose()
+  }
+
+  @Test
+  fun dragFloodAllocatesOneEventPerKind() {
+    val instances = Collections.newSetFromMap(IdentityHashMap<Any, Boolean>())
+
+    // Each sample is dispatched and disposed before the next frame, as the coalescer delivers them
+    for (frame in 1..FRAMES) {
+      val position = obtainPosition(VIEW_ID, frame)
+      val drag = obtainDrag(VIEW_ID, frame)
+      instances += position
+      instances += drag
+      position.dispose()
+      drag.dispose()
+    }
+
+    assertEquals(2, instances.size)
+  }
+
+  companion object {
+    private const val SURFACE_ID = 1
+    private const val VIEW_ID = 2
+    private const val OTHER_VIEW_ID = 4
+    private const val FRAMES = 10_000
+  }
+}
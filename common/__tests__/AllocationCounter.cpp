@@ -0,0 +1,42 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local bool countAllocations = false;
+thread_local size_t allocationCount = 0;
+
+} // namespace
+
+void *operator new(std::size_t size) {
+  if (countAllocations) {
+    allocationCount++;
+  }
+  if (void *pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+AllocationCounter::AllocationCounter() {
+  allocationCount = 0;
+  countAllocations = true;
+}
+
+AllocationCounter::~AllocationCounter() {
+  countAllocations = false;
+}
+
+size_t AllocationCounter::getCount() const {
+  return allocationCount;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+/*
+ * Counts `operator new` calls made on the constructing thread while the counter is alive.
+ * Used to check that per-frame paths don't allocate.
+ */
+class AllocationCounter {
+ public:
+  AllocationCounter();
+  ~AllocationCounter();
+
+  AllocationCounter(const AllocationCounter &) = delete;
+  AllocationCounter &operator=(const AllocationCounter &) = delete;
+
+  size_t getCount() const;
+};
@@ -0,0 +1,217 @@
+#include <react/renderer/components/TrueSheetSpec/TrueSheetCommandQueue.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+constexpr int32_t kSheet = 1;
+constexpr int32_t kOtherSheet = 2;
+
+TrueSheetCommand command(int32_t tag, TrueSheetCommandType type, int32_t index = 0) {
+  static int32_t lastId = 0;
+  TrueSheetCommand result;
+  result.tag = tag;
+  result.type = type;
+  result.index = index;
+  result.id = ++lastId;
+  return result;
+}
+
+std::vector<TrueSheetCommand> merge(
+    std::vector<TrueSheetCommand> batch,
+    const std::unordered_set<int32_t> &presented = {}) {
+  TrueSheetCommandQueue::markSuperseded(batch, [&](int32_t tag) { return presented.count(tag) > 0; });
+  return batch;
+}
+
+std::vector<bool> superseded(const std::vector<TrueSheetCommand> &batch) {
+  std::vector<bool> result;
+  for (const auto &entry : batch) {
+    result.push_back(entry.superseded);
+  }
+  return result;
+}
+
+/*
+ * Resets the shared queue around each test, as it is process wide.
+ */
+class TrueSheetCommandQueueTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    reset();
+  }
+
+  void TearDown() override {
+    reset();
+  }
+
+  static void reset() {
+    TrueSheetCommandQueue::setScheduler(nullptr);
+    drain();
+  }
+
+  static std::vector<TrueSheetCommand> drain() {
+    return TrueSheetCommandQueue::drain([](int32_t) { return false; });
+  }
+};
+
+} // namespace
+
+TEST(TrueSheetCommandMerge, ResizeSupersedesPendingResize) {
+  auto batch = merge(
+      {command(kSheet, TrueSheetCommandType::Resize, 0), command(kSheet, TrueSheetCommandType::Resize, 2)}, {kSheet});
+
+  EXPECT_EQ(superseded(batch), (std::vector<bool>{true, false}));
+  EXPECT_EQ(batch[1].index, 2);
+}
+
+TEST(TrueSheetCommandMerge, ResizeFoldsIntoPendingPresent) {
+  auto batch = merge(
+      {command(kSheet, TrueSheetCommandType::Present, 0), command(kSheet, TrueSheetCommandType::Resize, 2)});
+
+  EXPECT_EQ(superseded(batch), (std::vector<bool>{false, true}));
+  EXPECT_EQ(batch[0].index, 2);
+}
+
+TEST(TrueSheetCommandMerge, PresentFoldsIntoPendingPresent) {
+  auto batch = merge(
+      {command(kSheet, TrueSheetCommandType::Present, 0),
+       command(kSheet, TrueSheetCommandType::Present, 2),
+       command(kSheet, TrueSheetCommandType::Present, 1)});
+
+  EXPECT_EQ(superseded(batch), (std::vector<bool>{false, true, true}));
+  EXPECT_EQ(batch[0].index, 1);
+}
+
+TEST(TrueSheetCommandMerge, DismissCancelsPresentOfHiddenSheet) {
+  auto batch = merge(
+      {command(kSheet, TrueSheetCommandType::Present, 1),
+       command(kSheet, TrueSheetCommandType::Dismiss),
+       command(kSheet, TrueSheetCommandType::Present, 2)});
+
+  // The present after the dismiss starts over and runs
+  EXPECT_EQ(superseded(batch), (std::vector<bool>{true, true, false}));
+  EXPECT_EQ(batch[2].index, 2);
+}
+
+TEST(TrueSheetCommandMerge, DismissSupersedesPendingResize) {
+  auto batch = merge(
+      {command(kSheet, TrueSheetCommandType::Resize, 1), command(kSheet, TrueSheetCommandType::Dismiss)}, {kSheet});
+
+  EXPECT_EQ(superseded(batch), (std::vector<bool>{true, false}));
+}
+
+TEST(TrueSheetCommandMerge, PresentOfPresentedSheetTakesNoPart) {
+  auto batch = merge(
+      {command(kSheet, TrueSheetCommandType::Present, 0),
+       command(kSheet, TrueSheetCommandType::Present, 2),
+       command(kSheet, TrueSheetCommandType::Resize, 1)},
+      {kSheet});
+
+  EXPECT_EQ(superseded(batch), (std::vector<bool>{false, false, false}));
+  EXPECT_EQ(batch[0].index, 0);
+}
+
+TEST(TrueSheetCommandMerge, DismissStackTakesNoPart) {
+  auto batch = merge(
+      {command(kSheet, TrueSheetCommandType::Resize, 0),
+       command(kSheet, TrueSheetCommandType::DismissStack),
+       command(kSheet, TrueSheetCommandType::Resize, 2)},
+      {kSheet});
+
+  EXPECT_EQ(superseded(batch), (std::vector<bool>{true, false, false}));
+}
+
+TEST(TrueSheetCommandMerge, SheetsMergeIndependently) {
+  auto batch = merge(
+      {command(kSheet, TrueSheetCommandType::Present, 0),
+       command(kOtherSheet, TrueSheetCommandType::Resize, 1),
+       command(kSheet, TrueSheetCommandType::Present, 2),
+       command(kOtherSheet, TrueSheetCommandType::Dismiss)},
+      {kOtherSheet});
+
+  EXPECT_EQ(superseded(batch), (std::vector<bool>{false, true, true, false}));
+  EXPECT_EQ(batch[0].index, 2);
+}
+
+TEST_F(TrueSheetCommandQueueTest, DrainsInEnqueueOrder) {
+  auto first = command(kSheet, TrueSheetCommandType::Present, 1);
+  auto second = command(kOtherSheet, TrueSheetCommandType::Present, 0);
+  TrueSheetCommandQueue::enqueue({first});
+  TrueSheetCommandQueue::enqueue({second});
+
+  auto batch = drain();
+  ASSERT_EQ(batch.size(), 2u);
+  EXPECT_EQ(batch[0].id, first.id);
+  EXPECT_EQ(batch[1].id, second.id);
+  EXPECT_TRUE(drain().empty());
+}
+
+TEST_F(TrueSheetCommandQueueTest, SchedulesOneDrainPerBatch) {
+  int scheduled = 0;
+  TrueSheetCommandQueue::setScheduler([&] { scheduled++; });
+
+  TrueSheetCommandQueue::enqueue({});
+  EXPECT_EQ(scheduled, 0);
+
+  TrueSheetCommandQueue::enqueue({command(kSheet, TrueSheetCommandType::Present)});
+  TrueSheetCommandQueue::enqueue({command(kSheet, TrueSheetCommandType::Resize, 1)});
+  EXPECT_EQ(scheduled, 1);
+
+  drain();
+  TrueSheetCommandQueue::enqueue({command(kSheet, TrueSheetCommandType::Dismiss)});
+  EXPECT_EQ(scheduled, 2);
+}
+
+TEST_F(TrueSheetCommandQueueTest, RemovingOwnerDropsOnlyItsCommands) {
+  int scheduled = 0;
+  TrueSheetCommandQueue::setScheduler([&] { scheduled++; });
+  auto reloaded = TrueSheetCommandQueue::addOwner(nullptr);
+  auto current = TrueSheetCommandQueue::addOwner(nullptr);
+
+  auto stale = command(kSheet, TrueSheetCommandType::Present);
+  stale.owner = reloaded;
+  auto live = command(kOtherSheet, TrueSheetCommandType::Present);
+  live.owner = current;
+  TrueSheetCommandQueue::enqueue({stale, live});
+
+  TrueSheetCommandQueue::removeOwner(reloaded);
+  auto batch = drain();
+  ASSERT_EQ(batch.size(), 1u);
+  EXPECT_EQ(batch[0].id, live.id);
+
+  TrueSheetCommandQueue::removeOwner(current);
+  EXPECT_EQ(scheduled, 1);
+}
+
+TEST_F(TrueSheetCommandQueueTest, ReportsFailuresToTheirOwner) {
+  std::vector<std::pair<int32_t, std::string>> firstFailures;
+  std::vector<std::pair<int32_t, std::string>> secondFailures;
+  auto first = TrueSheetCommandQueue::addOwner(
+      [&](int32_t id, const std::string &error) { firstFailures.emplace_back(id, error); });
+  auto second = TrueSheetCommandQueue::addOwner(
+      [&](int32_t id, const std::string &error) { secondFailures.emplace_back(id, error); });
+
+  auto failed = command(kSheet, TrueSheetCommandType::Resize);
+  failed.owner = first;
+  TrueSheetCommandQueue::fail(failed, "No sheet found with tag 1");
+
+  ASSERT_EQ(firstFailures.size(), 1u);
+  EXPECT_EQ(firstFailures[0].first, failed.id);
+  EXPECT_EQ(firstFailures[0].second, "No sheet found with tag 1");
+  EXPECT_TRUE(secondFailures.empty());
+
+  // Once its runtime is gone, failures are dropped
+  TrueSheetCommandQueue::removeOwner(first);
+  TrueSheetCommandQueue::fail(failed, "ignored");
+  EXPECT_EQ(firstFailures.size(), 1u);
+
+  TrueSheetCommandQueue::removeOwner(second);
+}
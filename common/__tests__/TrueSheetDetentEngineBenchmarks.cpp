@@ -0,0 +1,91 @@
+#include <react/renderer/components/TrueSheetSpec/TrueSheetDetentEngine.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+TrueSheetDetentEngine makeEngine(int detentCount) {
+  std::vector<double> detents;
+  for (int i = 1; i <= detentCount; i++) {
+    detents.push_back(static_cast<double>(i) / detentCount);
+  }
+
+  TrueSheetDetentLayout layout;
+  layout.screenHeight = 2400;
+  layout.contentHeight = 900;
+  layout.bottomInset = 48;
+  layout.integralHeights = true;
+
+  TrueSheetDetentEngine engine;
+  engine.setDetents(detents.data(), detents.size());
+  engine.setLayout(layout);
+  return engine;
+}
+
+// Sheet heights swept like a drag across the whole detent range
+double dragHeight(int64_t frame) {
+  return static_cast<double>(frame % 2400);
+}
+
+void BM_FindSegment(benchmark::State &state) {
+  auto engine = makeEngine(static_cast<int>(state.range(0)));
+  int64_t frame = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(engine.findSegment(dragHeight(frame++)));
+  }
+}
+BENCHMARK(BM_FindSegment)->Arg(3)->Arg(8)->Arg(64);
+
+// Per drag frame, Android and iOS query the interpolated index and detent for the same height
+void BM_DragFrame(benchmark::State &state) {
+  auto engine = makeEngine(static_cast<int>(state.range(0)));
+  int64_t frame = 0;
+  for (auto _ : state) {
+    double height = dragHeight(frame++);
+    benchmark::DoNotOptimize(engine.getInterpolatedIndex(height));
+    benchmark::DoNotOptimize(engine.getInterpolatedDetent(height));
+  }
+}
+BENCHMARK(BM_DragFrame)->Arg(3)->Arg(8)->Arg(64);
+
+// Unchanged layouts are compared and skipped, which is the common case when syncing per frame
+void BM_SetLayoutUnchanged(benchmark::State &state) {
+  auto engine = makeEngine(3);
+  auto layout = engine.getLayout();
+  for (auto _ : state) {
+    engine.setLayout(layout);
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_SetLayoutUnchanged);
+
+void BM_SetLayoutChanged(benchmark::State &state) {
+  auto engine = makeEngine(static_cast<int>(state.range(0)));
+  auto layout = engine.getLayout();
+  int64_t frame = 0;
+  for (auto _ : state) {
+    layout.keyboardInset = static_cast<double>(frame++ % 600);
+    engine.setLayout(layout);
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_SetLayoutChanged)->Arg(3)->Arg(8)->Arg(64);
+
+void BM_PredictSettleIndex(benchmark::State &state) {
+  auto engine = makeEngine(static_cast<int>(state.range(0)));
+  int64_t frame = 0;
+  for (auto _ : state) {
+    TrueSheetSettleRelease release;
+    release.sheetHeight = dragHeight(frame);
+    release.velocity = frame++ % 2 == 0 ? 1500 : -1500;
+    release.dismissible = true;
+    benchmark::DoNotOptimize(engine.predictSettleIndex(release));
+  }
+}
+BENCHMARK(BM_PredictSettleIndex)->Arg(3)->Arg(8)->Arg(64);
+
+} // namespace
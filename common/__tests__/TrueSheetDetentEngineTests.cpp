@@ -0,0 +1,241 @@
+#include <react/renderer/components/TrueSheetSpec/TrueSheetDetentEngine.h>
+
+#include <gtest/gtest.h>
+
+#include "AllocationCounter.h"
+
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+TrueSheetDetentLayout makeLayout() {
+  TrueSheetDetentLayout layout;
+  layout.screenHeight = 1000;
+  layout.contentHeight = 300;
+  layout.headerHeight = 50;
+  layout.bottomInset = 20;
+  return layout;
+}
+
+TrueSheetDetentEngine makeEngine(const std::vector<double> &detents, const TrueSheetDetentLayout &layout = makeLayout()) {
+  TrueSheetDetentEngine engine;
+  engine.setDetents(detents.data(), detents.size());
+  engine.setLayout(layout);
+  return engine;
+}
+
+void expectSegment(const TrueSheetDetentSegment &segment, int fromIndex, int toIndex, double progress, bool between) {
+  EXPECT_EQ(segment.fromIndex, fromIndex);
+  EXPECT_EQ(segment.toIndex, toIndex);
+  EXPECT_DOUBLE_EQ(segment.progress, progress);
+  EXPECT_EQ(segment.between, between);
+}
+
+} // namespace
+
+TEST(TrueSheetDetentEngine, ResolvesDetentValues) {
+  auto engine = makeEngine({TrueSheetDetentEngine::kAutoDetent, TrueSheetDetentEngine::kPeekDetent, 0.5});
+
+  EXPECT_DOUBLE_EQ(engine.getDetentValue(0), 0.35);
+  EXPECT_DOUBLE_EQ(engine.getDetentValue(1), 0.05);
+  EXPECT_DOUBLE_EQ(engine.getDetentValue(2), 0.5);
+  EXPECT_DOUBLE_EQ(engine.getDetentValue(3), 0);
+  EXPECT_DOUBLE_EQ(engine.getDetentValue(-1), 0);
+}
+
+TEST(TrueSheetDetentEngine, PeekFallsBackWhenEmpty) {
+  auto layout = makeLayout();
+  layout.headerHeight = 0;
+  auto engine = makeEngine({TrueSheetDetentEngine::kPeekDetent}, layout);
+
+  EXPECT_DOUBLE_EQ(engine.getPeekHeight(), 150);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(0), 170);
+}
+
+TEST(TrueSheetDetentEngine, DetentHeightIncludesInsetsAndClamps) {
+  auto layout = makeLayout();
+  layout.keyboardInset = 100;
+  auto engine = makeEngine({0.5}, layout);
+
+  EXPECT_DOUBLE_EQ(engine.getDetentHeight(0.5), 620);
+  EXPECT_DOUBLE_EQ(engine.getDetentHeight(0.5, false), 520);
+  EXPECT_DOUBLE_EQ(engine.getDetentHeight(1), 1020);
+  EXPECT_DOUBLE_EQ(engine.getDetentHeight(TrueSheetDetentEngine::kAutoDetent, false), 370);
+  EXPECT_DOUBLE_EQ(engine.getDetentHeight(1.5), 0);
+
+  layout.maxContentHeight = 400;
+  engine.setLayout(layout);
+  EXPECT_DOUBLE_EQ(engine.getDetentHeight(0.5), 400);
+}
+
+TEST(TrueSheetDetentEngine, IntegralHeightsTruncateFractions) {
+  auto layout = makeLayout();
+  layout.screenHeight = 999;
+  layout.bottomInset = 0;
+  layout.integralHeights = true;
+  auto engine = makeEngine({0.5}, layout);
+
+  EXPECT_DOUBLE_EQ(engine.getDetentHeight(0.5), 499);
+}
+
+TEST(TrueSheetDetentEngine, ResolvedHeightsClampToContainer) {
+  auto layout = makeLayout();
+  layout.topInset = 40;
+  auto engine = makeEngine({0.25, 0.5, 1}, layout);
+
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(0), 270);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(1), 520);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(2), 960);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(3), 0);
+
+  layout.containerHeight = 900;
+  engine.setLayout(layout);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(2), 860);
+}
+
+TEST(TrueSheetDetentEngine, ScalesAgainstMaxDetentHeight) {
+  auto layout = makeLayout();
+  layout.maxDetentHeight = 800;
+  auto engine = makeEngine({0.25, 1}, layout);
+
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(0), 200);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(1), 800);
+
+  engine.setResolverHeight(0, 240);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(0), 240);
+}
+
+TEST(TrueSheetDetentEngine, LearnedOffsetsFallBackAcrossDetents) {
+  auto engine = makeEngine({0.25, 0.5});
+
+  engine.setResolverHeight(0, 250);
+  engine.learnOffset(0, 262);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(0), 262);
+
+  // Detent 1 has no offset of its own yet
+  engine.setResolverHeight(1, 480);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(1), 492);
+
+  engine.learnOffset(1, 485);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(1), 485);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(0), 262);
+
+  engine.clearResolvedHeights();
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(0), 270);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(1), 520);
+}
+
+TEST(TrueSheetDetentEngine, FindsSegments) {
+  auto engine = makeEngine({0.25, 0.5, 1});
+
+  expectSegment(engine.findSegment(135), -1, 0, 0.5, false);
+  expectSegment(engine.findSegment(270), 0, 1, 0, true);
+  expectSegment(engine.findSegment(395), 0, 1, 0.5, true);
+  expectSegment(engine.findSegment(520), 0, 1, 1, true);
+  expectSegment(engine.findSegment(1000), 1, 2, 1, true);
+  expectSegment(engine.findSegment(1200), 2, 2, 0, false);
+}
+
+TEST(TrueSheetDetentEngine, FindsSegmentsAcrossManyDetents) {
+  auto layout = makeLayout();
+  layout.bottomInset = 0;
+  auto engine = makeEngine({0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8}, layout);
+
+  expectSegment(engine.findSegment(455), 3, 4, 0.55, true);
+  expectSegment(engine.findSegment(790), 6, 7, 0.9, true);
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedIndex(455), 3.55);
+}
+
+TEST(TrueSheetDetentEngine, EqualHeightRunsMatchLinearScan) {
+  auto layout = makeLayout();
+  layout.keyboardInset = 600;
+  auto engine = makeEngine({0.25, 0.5, 1}, layout);
+
+  // Keyboard growth clamps detents 1 and 2 to the container height
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(0), 870);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(1), 1000);
+  EXPECT_DOUBLE_EQ(engine.getResolvedHeight(2), 1000);
+  expectSegment(engine.findSegment(935), 0, 1, 0.5, true);
+  expectSegment(engine.findSegment(1000), 0, 1, 1, true);
+
+  auto clamped = makeEngine({0.9, 1}, layout);
+  expectSegment(clamped.findSegment(1000), 1, 1, 0, false);
+}
+
+TEST(TrueSheetDetentEngine, UnorderedHeightsUseLinearScan) {
+  auto engine = makeEngine({0.25, 0.5, 1});
+  engine.setResolverHeight(1, 200);
+
+  expectSegment(engine.findSegment(600), 1, 2, 0.5, true);
+  expectSegment(engine.findSegment(1000), 1, 2, 1, true);
+}
+
+/*
+ * The lookups a drag runs on every slide callback. None of them may allocate.
+ */
+TEST(TrueSheetDetentEngine, DragLookupsDoNotAllocate) {
+  constexpr int frames = 10'000;
+  auto engine = makeEngine({0.1, 0.25, 0.5, 0.75, 1});
+  double checksum = 0;
+
+  AllocationCounter allocations;
+  for (int frame = 0; frame < frames; frame++) {
+    auto sheetHeight = static_cast<double>(frame % 1200);
+    auto segment = engine.findSegment(sheetHeight);
+    checksum += segment.progress + engine.getInterpolatedIndex(sheetHeight) +
+      engine.getInterpolatedDetent(sheetHeight);
+  }
+
+  EXPECT_EQ(allocations.getCount(), 0u);
+  EXPECT_GT(checksum, 0);
+}
+
+TEST(TrueSheetDetentEngine, InterpolatesIndexAndDetent) {
+  auto engine = makeEngine({0.25, 0.5, 1});
+
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedIndex(135), -0.5);
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedIndex(395), 0.5);
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedIndex(1200), 2);
+
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedDetent(135), 0.125);
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedDetent(395), 0.375);
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedDetent(1200), 1);
+}
+
+TEST(TrueSheetDetentEngine, EmptyDetents) {
+  TrueSheetDetentEngine engine;
+  engine.setLayout(makeLayout());
+
+  expectSegment(engine.findSegment(100), -1, 0, 0, false);
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedIndex(100), -1);
+  EXPECT_DOUBLE_EQ(engine.getInterpolatedDetent(100), 0);
+  EXPECT_EQ(engine.predictSettleIndex({}), -1);
+}
+
+TEST(TrueSheetDetentEngine, PredictsSettleAtRest) {
+  auto engine = makeEngine({0.25, 0.5, 1});
+
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 500}), 1);
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 800}), 2);
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 800, .velocity = -50, .restVelocity = 100}), 2);
+}
+
+TEST(TrueSheetDetentEngine, PredictsSettleInReleaseDirection) {
+  auto engine = makeEngine({0.25, 0.5, 1});
+
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 300, .velocity = 1000}), 1);
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 600, .velocity = -1000}), 1);
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 600, .velocity = 1000, .maxIndex = 1}), 1);
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 150, .velocity = -500}), 0);
+}
+
+TEST(TrueSheetDetentEngine, PredictsDismiss) {
+  auto engine = makeEngine({0.25, 0.5, 1});
+
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 150, .velocity = -500, .dismissible = true}), -1);
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 600, .velocity = -1000, .dismissible = true}), 1);
+  // The first reachable detent is above 0, so the sheet can't be dragged closed
+  EXPECT_EQ(engine.predictSettleIndex({.sheetHeight = 150, .velocity = -500, .minIndex = 1, .dismissible = true}), 1);
+}
@@ -0,0 +1,252 @@
+#include <react/renderer/components/TrueSheetSpec/TrueSheetPositionChannel.h>
+
+#include <gtest/gtest.h>
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+// Every field derives from the sequence, so a torn read shows up as a mismatch
+TrueSheetPositionSample sampleFor(uint64_t sequence) {
+  auto value = static_cast<double>(sequence);
+  return {value, value * 2, value * 3, value * 4, sequence % 2 == 0};
+}
+
+void expectSample(const TrueSheetPositionSample &sample, uint64_t sequence) {
+  auto expected = sampleFor(sequence);
+  EXPECT_EQ(sample.index, expected.index);
+  EXPECT_EQ(sample.position, expected.position);
+  EXPECT_EQ(sample.detent, expected.detent);
+  EXPECT_EQ(sample.timestamp, expected.timestamp);
+  EXPECT_EQ(sample.realtime, expected.realtime);
+}
+
+bool isConsistent(const TrueSheetPositionSample &sample, uint64_t sequence) {
+  auto expected = sampleFor(sequence);
+  return sample.index == expected.index && sample.position == expected.position &&
+      sample.detent == expected.detent && sample.timestamp == expected.timestamp &&
+      sample.realtime == expected.realtime;
+}
+
+} // namespace
+
+TEST(TrueSheetPositionChannel, EmptyChannel) {
+  TrueSheetPositionChannel channel;
+  TrueSheetPositionSample sample;
+  uint64_t sequence = 42;
+
+  EXPECT_EQ(channel.getSequence(), 0u);
+  EXPECT_FALSE(channel.readLatest(sample, sequence));
+  EXPECT_EQ(sequence, 42u);
+  EXPECT_FALSE(channel.read(0, sample));
+  EXPECT_FALSE(channel.read(1, sample));
+}
+
+TEST(TrueSheetPositionChannel, ReadsLatestSample) {
+  TrueSheetPositionChannel channel;
+  TrueSheetPositionSample sample;
+  uint64_t sequence = 0;
+
+  for (uint64_t i = 1; i <= 3; i++) {
+    channel.write(sampleFor(i));
+    ASSERT_TRUE(channel.readLatest(sample, sequence));
+    EXPECT_EQ(sequence, i);
+    expectSample(sample, i);
+  }
+  EXPECT_EQ(channel.getSequence(), 3u);
+}
+
+TEST(TrueSheetPositionChannel, ReadsRecentSamplesBySequence) {
+  TrueSheetPositionChannel channel;
+  TrueSheetPositionSample sample;
+
+  for (uint64_t i = 1; i <= 10; i++) {
+    channel.write(sampleFor(i));
+  }
+
+  for (uint64_t i = 1; i <= 10; i++) {
+    ASSERT_TRUE(channel.read(i, sample));
+    expectSample(sample, i);
+  }
+  EXPECT_FALSE(channel.read(11, sample));
+}
+
+TEST(TrueSheetPositionChannel, OverwritesSamplesOlderThanCapacity) {
+  TrueSheetPositionChannel channel;
+  TrueSheetPositionSample sample;
+  constexpr uint64_t count = TrueSheetPositionChannel::kCapacity + 5;
+
+  for (uint64_t i = 1; i <= count; i++) {
+    channel.write(sampleFor(i));
+  }
+
+  for (uint64_t i = 1; i <= 5; i++) {
+    EXPECT_FALSE(channel.read(i, sample)) << "sequence " << i;
+  }
+  for (uint64_t i = 6; i <= count; i++) {
+    ASSERT_TRUE(channel.read(i, sample));
+    expectSample(sample, i);
+  }
+}
+
+TEST(TrueSheetPositionChannel, RegistersChannelsByTag) {
+  auto channel = std::make_shared<TrueSheetPositionChannel>();
+
+  EXPECT_EQ(TrueSheetPositionChannelRegistry::getChannel(7), nullptr);
+  TrueSheetPositionChannelRegistry::registerChannel(7, channel);
+  EXPECT_EQ(TrueSheetPositionChannelRegistry::getChannel(7), channel);
+  EXPECT_EQ(TrueSheetPositionChannelRegistry::getChannel(8), nullptr);
+
+  TrueSheetPositionChannelRegistry::unregisterChannel(7);
+  EXPECT_EQ(TrueSheetPositionChannelRegistry::getChannel(7), nullptr);
+}
+
+TEST(TrueSheetPositionCursor, SnapshotsNewestSample) {
+  TrueSheetPositionChannel channel;
+  TrueSheetPositionCursor cursor;
+
+  EXPECT_FALSE(cursor.isAt(channel));
+  EXPECT_EQ(cursor.seekLatest(channel), 0u);
+  EXPECT_TRUE(cursor.isAt(channel));
+
+  channel.write(sampleFor(1));
+  channel.write(sampleFor(2));
+  EXPECT_EQ(cursor.seekLatest(channel), 2u);
+
+  // Fields keep coming from the snapshot while the producer moves on
+  channel.write(sampleFor(3));
+  EXPECT_EQ(cursor.getSequence(), 2u);
+  expectSample(cursor.getSample(), 2);
+}
+
+TEST(TrueSheetPositionCursor, SeeksBySequence) {
+  TrueSheetPositionChannel channel;
+  TrueSheetPositionCursor cursor;
+  constexpr uint64_t count = TrueSheetPositionChannel::kCapacity + 5;
+
+  for (uint64_t i = 1; i <= count; i++) {
+    channel.write(sampleFor(i));
+  }
+
+  ASSERT_TRUE(cursor.seek(channel, 10));
+  EXPECT_EQ(cursor.getSequence(), 10u);
+  expectSample(cursor.getSample(), 10);
+
+  // Overwritten and future samples keep the loaded one
+  EXPECT_FALSE(cursor.seek(channel, 1));
+  EXPECT_FALSE(cursor.seek(channel, count + 1));
+  EXPECT_EQ(cursor.getSequence(), 10u);
+  expectSample(cursor.getSample(), 10);
+}
+
+/*
+ * What the JS host object does on every UI frame while a sheet moves: snapshot the newest
+ * sample through `sequence`, then read its fields. None of it may allocate.
+ */
+TEST(TrueSheetPositionCursor, PollingDoesNotAllocate) {
+  constexpr uint64_t frames = 10'000;
+
+  TrueSheetPositionChannel channel;
+  TrueSheetPositionCursor cursor;
+  double checksum = 0;
+
+  AllocationCounter allocations;
+  for (uint64_t frame = 1; frame <= frames; frame++) {
+    channel.write(sampleFor(frame));
+    if (cursor.seekLatest(channel) == frame) {
+      const auto &sample = cursor.getSample();
+      checksum += sample.index + sample.position + sample.detent + sample.timestamp + (sample.realtime ? 1 : 0);
+    }
+  }
+
+  EXPECT_EQ(allocations.getCount(), 0u);
+  EXPECT_GT(checksum, 0);
+}
+
+/*
+ * One producer writes as fast as it can while readers poll the newest sample and catch up on
+ * older ones. Readers must never see a torn sample, and the newest sequence must never go back.
+ */
+TEST(TrueSheetPositionChannel, ConcurrentWriterAndReaders) {
+  constexpr uint64_t writes = 1'000'000;
+  constexpr int readerCount = 3;
+
+  TrueSheetPositionChannel channel;
+  std::atomic<int> started{0};
+  std::atomic<bool> done{false};
+  std::atomic<uint64_t> tornReads{0};
+  std::atomic<uint64_t> regressions{0};
+  std::atomic<uint64_t> samplesRead{0};
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < readerCount; r++) {
+    readers.emplace_back([&] {
+      uint64_t lastSequence = 0;
+      uint64_t reads = 0;
+      TrueSheetPositionSample sample;
+      started.fetch_add(1, std::memory_order_release);
+
+      // Reads at least once more after the writer finishes
+      bool finished = false;
+      while (!finished) {
+        finished = done.load(std::memory_order_acquire);
+        uint64_t sequence = 0;
+        if (!channel.readLatest(sample, sequence)) {
+          continue;
+        }
+        reads++;
+        if (!isConsistent(sample, sequence)) {
+          tornReads.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (sequence < lastSequence) {
+          regressions.fetch_add(1, std::memory_order_relaxed);
+        }
+        lastSequence = sequence;
+
+        // Catch up like a consumer that fell behind; overwritten samples fail instead of tearing
+        for (uint64_t back = 1; back < TrueSheetPositionChannel::kCapacity && back < sequence; back += 7) {
+          if (channel.read(sequence - back, sample)) {
+            reads++;
+            if (!isConsistent(sample, sequence - back)) {
+              tornReads.fetch_add(1, std::memory_order_relaxed);
+            }
+          }
+        }
+      }
+
+      samplesRead.fetch_add(reads, std::memory_order_relaxed);
+    });
+  }
+
+  std::thread writer([&] {
+    while (started.load(std::memory_order_acquire) < readerCount) {
+      std::this_thread::yield();
+    }
+    for (uint64_t i = 1; i <= writes; i++) {
+      channel.write(sampleFor(i));
+    }
+    done.store(true, std::memory_order_release);
+  });
+
+  writer.join();
+  for (auto &reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(tornReads.load(), 0u);
+  EXPECT_EQ(regressions.load(), 0u);
+  EXPECT_GT(samplesRead.load(), 0u);
+  EXPECT_EQ(channel.getSequence(), writes);
+
+  TrueSheetPositionSample sample;
+  uint64_t sequence = 0;
+  ASSERT_TRUE(channel.readLatest(sample, sequence));
+  EXPECT_EQ(sequence, writes);
+  expectSample(sample, writes);
+}
@@ -0,0 +1,116 @@
+#include <react/renderer/components/TrueSheetSpec/TrueSheetPositionSampler.h>
+
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+
+namespace {
+
+constexpr int kFrames = 120;
+constexpr double kFrameInterval = 1000.0 / 120;
+
+TrueSheetPositionPolicy makePolicy(bool settledOnly, double maxHz, double minDelta) {
+  TrueSheetPositionPolicy policy;
+  policy.settledOnly = settledOnly;
+  policy.maxHz = maxHz;
+  policy.minDelta = minDelta;
+  return policy;
+}
+
+/*
+ * Drives one second of a 120 Hz drag moving `distance` points in total, then the settle sample.
+ * Returns how many realtime samples were emitted.
+ */
+int emittedDuringDrag(TrueSheetPositionSampler &sampler, double distance, bool *settleEmitted = nullptr) {
+  int emitted = 0;
+  for (int frame = 0; frame < kFrames; frame++) {
+    double position = distance * frame / kFrames;
+    if (sampler.shouldEmit(position, true, frame * kFrameInterval)) {
+      emitted++;
+    }
+  }
+
+  bool settled = sampler.shouldEmit(distance, false, kFrames * kFrameInterval);
+  if (settleEmitted) {
+    *settleEmitted = settled;
+  }
+  return emitted;
+}
+
+} // namespace
+
+TEST(TrueSheetPositionSampler, EveryFrameEmitsEverySample) {
+  TrueSheetPositionSampler sampler;
+  bool settled = false;
+
+  EXPECT_TRUE(sampler.isUnrestricted());
+  EXPECT_EQ(emittedDuringDrag(sampler, 600, &settled), kFrames);
+  EXPECT_TRUE(settled);
+}
+
+TEST(TrueSheetPositionSampler, SettledOnlyEmitsOnlyTheSettle) {
+  TrueSheetPositionSampler sampler;
+  sampler.setPolicy(makePolicy(true, 0, 0));
+  bool settled = false;
+
+  EXPECT_FALSE(sampler.isUnrestricted());
+  EXPECT_EQ(emittedDuringDrag(sampler, 600, &settled), 0);
+  EXPECT_TRUE(settled);
+}
+
+TEST(TrueSheetPositionSampler, MaxHzLimitsTheRate) {
+  for (double maxHz : {30.0, 60.0, 120.0}) {
+    TrueSheetPositionSampler sampler;
+    sampler.setPolicy(makePolicy(false, maxHz, 0));
+    bool settled = false;
+
+    EXPECT_EQ(emittedDuringDrag(sampler, 600, &settled), static_cast<int>(maxHz)) << maxHz << " Hz";
+    EXPECT_TRUE(settled);
+  }
+}
+
+TEST(TrueSheetPositionSampler, MinDeltaSkipsSmallMoves) {
+  TrueSheetPositionSampler sampler;
+  sampler.setPolicy(makePolicy(false, 0, 5));
+  bool settled = false;
+
+  // 0.5 points per frame, so every tenth frame moves far enough
+  EXPECT_EQ(emittedDuringDrag(sampler, 60, &settled), 12);
+  EXPECT_TRUE(settled);
+}
+
+TEST(TrueSheetPositionSampler, CombinedLimitsBothApply) {
+  TrueSheetPositionSampler sampler;
+  sampler.setPolicy(makePolicy(false, 60, 5));
+
+  // 5 points per frame clears minDelta every frame, so maxHz decides
+  EXPECT_EQ(emittedDuringDrag(sampler, 600), 60);
+}
+
+TEST(TrueSheetPositionSampler, SettleBecomesTheReference) {
+  TrueSheetPositionSampler sampler;
+  sampler.setPolicy(makePolicy(false, 0, 5));
+
+  EXPECT_TRUE(sampler.shouldEmit(100, true, 0));
+  EXPECT_TRUE(sampler.shouldEmit(102, false, 10));
+  EXPECT_FALSE(sampler.shouldEmit(106, true, 20));
+  EXPECT_TRUE(sampler.shouldEmit(107, true, 30));
+}
+
+TEST(TrueSheetPositionSampler, ChangingThePolicyForgetsTheLastSample) {
+  TrueSheetPositionSampler sampler;
+  sampler.setPolicy(makePolicy(false, 0, 5));
+
+  EXPECT_TRUE(sampler.shouldEmit(100, true, 0));
+  EXPECT_FALSE(sampler.shouldEmit(101, true, 10));
+
+  // Setting the same policy keeps the reference
+  sampler.setPolicy(makePolicy(false, 0, 5));
+  EXPECT_FALSE(sampler.shouldEmit(101, true, 20));
+
+  sampler.setPolicy(makePolicy(false, 0, 4));
+  EXPECT_TRUE(sampler.shouldEmit(101, true, 30));
+
+  sampler.reset();
+  EXPECT_TRUE(sampler.shouldEmit(101, true, 40));
+}
@@ -0,0 +1,131 @@
+#include <react/renderer/components/TrueSheetSpec/TrueSheetViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/utils/ContextContainer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+using ShadowNodePtr = std::shared_ptr<const ShadowNode>;
+using StatePtr = std::shared_ptr<const State>;
+using ChildList = std::vector<ShadowNodePtr>;
+
+constexpr SurfaceId kSurfaceId = 1;
+
+/*
+ * A sheet shadow node with a chain of `contentDepth` views below it, created the way the
+ * renderer creates them on mount.
+ */
+class SheetFixture final {
+ public:
+  explicit SheetFixture(int contentDepth) {
+    contextContainer_ = std::make_shared<ContextContainer>();
+    ComponentDescriptorParameters parameters{EventDispatcher::Weak{}, contextContainer_, nullptr};
+    sheetDescriptor_ = std::make_unique<TrueSheetViewComponentDescriptor>(parameters);
+    viewDescriptor_ = std::make_unique<ViewComponentDescriptor>(parameters);
+
+    ShadowNodePtr content;
+    for (int depth = 0; depth < contentDepth; depth++) {
+      content = createNode(*viewDescriptor_, content);
+    }
+    sheet_ = createNode(*sheetDescriptor_, content);
+  }
+
+  const ShadowNodePtr &sheet() const {
+    return sheet_;
+  }
+
+  /*
+   * Commits a container size from native, as `updateState` does.
+   */
+  StatePtr makeState(const ShadowNode &node, float width, float height) const {
+    return std::make_shared<const TrueSheetViewShadowNode::ConcreteState>(
+        std::make_shared<const TrueSheetViewState>(width, height), *node.getState());
+  }
+
+  ShadowNodePtr clone(const ShadowNode &node, const StatePtr &state = nullptr) const {
+    return sheetDescriptor_->cloneShadowNode(
+        node,
+        {ShadowNodeFragment::propsPlaceholder(),
+         ShadowNodeFragment::childrenPlaceholder(),
+         state ? state : ShadowNodeFragment::statePlaceholder()});
+  }
+
+ private:
+  ShadowNodePtr createNode(const ComponentDescriptor &descriptor, const ShadowNodePtr &child) {
+    auto family = descriptor.createFamily({nextTag_++, kSurfaceId, nullptr});
+    PropsParserContext parserContext{kSurfaceId, *contextContainer_};
+    auto props = descriptor.cloneProps(parserContext, nullptr, RawProps(folly::dynamic::object()));
+    auto state = descriptor.createInitialState(props, family);
+    auto children = std::make_shared<const ChildList>(child ? ChildList{child} : ChildList{});
+    return descriptor.createShadowNode({props, children, state}, family);
+  }
+
+  std::shared_ptr<ContextContainer> contextContainer_;
+  std::unique_ptr<ComponentDescriptor> sheetDescriptor_;
+  std::unique_ptr<ComponentDescriptor> viewDescriptor_;
+  ShadowNodePtr sheet_;
+  Tag nextTag_{2};
+};
+
+void BM_CreateSheet(benchmark::State &state) {
+  for (auto _ : state) {
+    SheetFixture fixture(static_cast<int>(state.range(0)));
+    benchmark::DoNotOptimize(fixture.sheet());
+  }
+}
+BENCHMARK(BM_CreateSheet)->Arg(0)->Arg(16)->Arg(256);
+
+// Commits that touch the sheet before native reports a container size
+void BM_CloneWithoutContainerSize(benchmark::State &state) {
+  SheetFixture fixture(static_cast<int>(state.range(0)));
+  auto node = fixture.sheet();
+  for (auto _ : state) {
+    node = fixture.clone(*node);
+    benchmark::DoNotOptimize(node);
+  }
+}
+BENCHMARK(BM_CloneWithoutContainerSize)->Arg(0)->Arg(16)->Arg(256);
+
+// Commits that touch a presented sheet whose container size is unchanged
+void BM_CloneWithContainerSize(benchmark::State &state) {
+  SheetFixture fixture(static_cast<int>(state.range(0)));
+  auto node = fixture.clone(*fixture.sheet(), fixture.makeState(*fixture.sheet(), 390, 844));
+  for (auto _ : state) {
+    node = fixture.clone(*node);
+    benchmark::DoNotOptimize(node);
+  }
+}
+BENCHMARK(BM_CloneWithContainerSize)->Arg(0)->Arg(16)->Arg(256);
+
+// Native container size updates, e.g. the keyboard or rotation resizing the sheet every commit
+void BM_ContainerSizeUpdates(benchmark::State &state) {
+  SheetFixture fixture(static_cast<int>(state.range(0)));
+  auto node = fixture.sheet();
+  bool toggle = false;
+  for (auto _ : state) {
+    toggle = !toggle;
+    node = fixture.clone(*node, fixture.makeState(*node, 390, toggle ? 844 : 520));
+    benchmark::DoNotOptimize(node);
+  }
+}
+BENCHMARK(BM_ContainerSizeUpdates)->Arg(0)->Arg(16)->Arg(256);
+
+// State updates that repeat the committed size
+void BM_RepeatedContainerSize(benchmark::State &state) {
+  SheetFixture fixture(static_cast<int>(state.range(0)));
+  auto node = fixture.sheet();
+  for (auto _ : state) {
+    node = fixture.clone(*node, fixture.makeState(*node, 390, 844));
+    benchmark::DoNotOptimize(node);
+  }
+}
+BENCHMARK(BM_RepeatedContainerSize)->Arg(0)->Arg(16)->Arg(256);
+
+} // namespace
@@ -0,0 +1,158 @@
+#include "TrueSheetCommandQueue.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+struct QueueState {
+  std::mutex mutex;
+  std::vector<TrueSheetCommand> pending;
+  TrueSheetCommandQueue::Scheduler scheduler;
+  std::unordered_map<int32_t, TrueSheetCommandQueue::FailureHandler> owners;
+  int32_t nextOwner{1};
+  bool drainScheduled{false};
+};
+
+QueueState &state() {
+  static QueueState queue;
+  return queue;
+}
+
+} // namespace
+
+void TrueSheetCommandQueue::setScheduler(Scheduler scheduler) {
+  auto &queue = state();
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  queue.scheduler = std::move(scheduler);
+  queue.drainScheduled = false;
+}
+
+int32_t TrueSheetCommandQueue::addOwner(FailureHandler handler) {
+  auto &queue = state();
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  auto owner = queue.nextOwner++;
+  queue.owners.emplace(owner, std::move(handler));
+  return owner;
+}
+
+void TrueSheetCommandQueue::removeOwner(int32_t owner) {
+  auto &queue = state();
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  queue.owners.erase(owner);
+  std::erase_if(queue.pending, [owner](const TrueSheetCommand &command) { return command.owner == owner; });
+}
+
+void TrueSheetCommandQueue::enqueue(const std::vector<TrueSheetCommand> &commands) {
+  if (commands.empty()) {
+    return;
+  }
+
+  auto &queue = state();
+  Scheduler scheduler;
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.pending.insert(queue.pending.end(), commands.begin(), commands.end());
+    if (queue.drainScheduled || !queue.scheduler) {
+      return;
+    }
+    queue.drainScheduled = true;
+    scheduler = queue.scheduler;
+  }
+
+  // Outside the lock, the platform may drain synchronously
+  scheduler();
+}
+
+void TrueSheetCommandQueue::fail(const TrueSheetCommand &command, const std::string &error) {
+  auto &queue = state();
+  FailureHandler failureHandler;
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    auto it = queue.owners.find(command.owner);
+    if (it == queue.owners.end()) {
+      // Its runtime is gone
+      return;
+    }
+    failureHandler = it->second;
+  }
+
+  failureHandler(command.id, error);
+}
+
+std::vector<TrueSheetCommand> TrueSheetCommandQueue::drain(const std::function<bool(int32_t tag)> &isPresented) {
+  auto &queue = state();
+  std::vector<TrueSheetCommand> batch;
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    batch.swap(queue.pending);
+    queue.drainScheduled = false;
+  }
+
+  markSuperseded(batch, isPresented);
+  return batch;
+}
+
+void TrueSheetCommandQueue::markSuperseded(
+    std::vector<TrueSheetCommand> &batch,
+    const std::function<bool(int32_t tag)> &isPresented) {
+  // Per sheet, the pending present or resize that will set its detent
+  std::unordered_map<int32_t, size_t> targets;
+  std::unordered_map<int32_t, bool> presented;
+
+  auto wasPresented = [&](int32_t tag) {
+    auto it = presented.find(tag);
+    if (it == presented.end()) {
+      it = presented.emplace(tag, isPresented(tag)).first;
+    }
+    return it->second;
+  };
+
+  for (size_t i = 0; i < batch.size(); i++) {
+    auto &command = batch[i];
+    auto it = targets.find(command.tag);
+    TrueSheetCommand *target = it != targets.end() ? &batch[it->second] : nullptr;
+
+    switch (command.type) {
+      case TrueSheetCommandType::Present:
+        if (target && target->type == TrueSheetCommandType::Present) {
+          target->index = command.index;
+          command.superseded = true;
+        } else if (!wasPresented(command.tag)) {
+          targets[command.tag] = i;
+        }
+        break;
+
+      case TrueSheetCommandType::Resize:
+        if (target && target->type == TrueSheetCommandType::Present) {
+          target->index = command.index;
+          command.superseded = true;
+        } else {
+          if (target) {
+            target->superseded = true;
+          }
+          targets[command.tag] = i;
+        }
+        break;
+
+      case TrueSheetCommandType::Dismiss:
+        if (target) {
+          target->superseded = true;
+          // Presents only become targets for hidden sheets, so the sheet just stays hidden
+          if (target->type == TrueSheetCommandType::Present) {
+            command.superseded = true;
+          }
+          targets.erase(it);
+        }
+        break;
+
+      case TrueSheetCommandType::DismissStack:
+        break;
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+enum class TrueSheetCommandType : int32_t {
+  Present = 0,
+  Resize = 1,
+  Dismiss = 2,
+  DismissStack = 3,
+};
+
+struct TrueSheetCommand {
+  int32_t tag{0};
+  TrueSheetCommandType type{TrueSheetCommandType::Present};
+  int32_t index{0};
+  bool animated{true};
+  // Reported back with the sheet's `onCommandComplete` event
+  int32_t id{0};
+  // Made redundant by a later command for the same sheet; completes without running
+  bool superseded{false};
+  // JS runtime that queued the command, see `TrueSheetCommandQueue::addOwner`
+  int32_t owner{0};
+};
+
+/*
+ * Sheet commands issued from JS, waiting for the UI thread.
+ * Commands enqueued before a drain form one batch that the UI thread runs in order, in a
+ * single pass, so a burst of present/resize/dismiss calls across sheets lands in the same frame
+ * instead of one main queue hop and promise per call. The first enqueue of a batch asks the
+ * platform to schedule the drain; later ones join the pending batch.
+ */
+class TrueSheetCommandQueue final {
+ public:
+  using Scheduler = std::function<void()>;
+  using FailureHandler = std::function<void(int32_t id, const std::string &error)>;
+
+  /*
+   * Called on the enqueuing thread when a new batch starts. Must post the drain to the UI thread.
+   */
+  static void setScheduler(Scheduler scheduler);
+
+  /*
+   * Registers a JS runtime that queues commands and returns the owner id to stamp on them.
+   * `handler` is called with its commands that couldn't run, e.g. because their sheet is no
+   * longer registered, and must settle them on the JS side, as no sheet is left to report them.
+   */
+  static int32_t addOwner(FailureHandler handler);
+
+  /*
+   * Unregisters a runtime when it is torn down, e.g. on reload. Its pending commands are dropped,
+   * as nothing waits for them anymore; commands of other runtimes stay queued.
+   */
+  static void removeOwner(int32_t owner);
+
+  static void enqueue(const std::vector<TrueSheetCommand> &commands);
+
+  /*
+   * Reports a drained command that couldn't run to the runtime that queued it.
+   */
+  static void fail(const TrueSheetCommand &command, const std::string &error);
+
+  /*
+   * UI thread only. Takes the pending batch, in enqueue order, with superseded commands marked.
+   * `isPresented` reports whether a sheet is presented before the batch runs.
+   */
+  static std::vector<TrueSheetCommand> drain(const std::function<bool(int32_t tag)> &isPresented);
+
+  /*
+   * Marks the commands of a batch that a later command for the same sheet makes redundant,
+   * so only the final target animates:
+   * - A resize supersedes the pending resize before it.
+   * - A resize after a pending present is folded into the present's index.
+   * - A present after a pending present is folded into the pending one's index.
+   * - A dismiss supersedes the pending resize, and cancels a pending present of a sheet that
+   *   was not presented, in which case the dismiss is superseded too.
+   * Presents of sheets that are already presented are no-ops and don't take part, and neither
+   * does a stack dismiss.
+   */
+  static void markSuperseded(std::vector<TrueSheetCommand> &batch, const std::function<bool(int32_t tag)> &isPresented);
+};
+
+} // namespace facebook::react
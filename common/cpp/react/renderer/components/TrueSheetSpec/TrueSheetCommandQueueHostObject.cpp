@@ -0,0 +1,107 @@
+#include "TrueSheetCommandQueueHostObject.h"
+
+#include <memory>
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr const char *kInstallName = "__TrueSheetCommands";
+constexpr const char *kFailureHandlerName = "__TrueSheetCommandFailed";
+
+int32_t intProperty(jsi::Runtime &runtime, const jsi::Object &object, const char *name, int32_t fallback) {
+  auto value = object.getProperty(runtime, name);
+  return value.isNumber() ? static_cast<int32_t>(value.asNumber()) : fallback;
+}
+
+bool commandFromValue(jsi::Runtime &runtime, const jsi::Value &value, TrueSheetCommand &out) {
+  if (!value.isObject()) {
+    return false;
+  }
+
+  auto object = value.asObject(runtime);
+  auto type = intProperty(runtime, object, "type", -1);
+  if (type < static_cast<int32_t>(TrueSheetCommandType::Present) ||
+      type > static_cast<int32_t>(TrueSheetCommandType::DismissStack)) {
+    return false;
+  }
+
+  out.tag = intProperty(runtime, object, "tag", 0);
+  out.type = static_cast<TrueSheetCommandType>(type);
+  out.index = intProperty(runtime, object, "index", 0);
+  out.id = intProperty(runtime, object, "id", 0);
+
+  auto animated = object.getProperty(runtime, "animated");
+  out.animated = animated.isBool() ? animated.getBool() : true;
+  return out.tag > 0;
+}
+
+} // namespace
+
+TrueSheetCommandQueueHostObject::TrueSheetCommandQueueHostObject(const std::shared_ptr<CallInvoker> &callInvoker) {
+  // Failures are reported on the UI thread, so hop to the JS thread to settle the command
+  std::weak_ptr<CallInvoker> weakCallInvoker = callInvoker;
+  owner_ = TrueSheetCommandQueue::addOwner([weakCallInvoker](int32_t id, const std::string &error) {
+    auto invoker = weakCallInvoker.lock();
+    if (!invoker) {
+      return;
+    }
+
+    invoker->invokeAsync([id, error](jsi::Runtime &rt) {
+      auto handler = rt.global().getProperty(rt, kFailureHandlerName);
+      if (handler.isObject() && handler.asObject(rt).isFunction(rt)) {
+        auto message = jsi::String::createFromUtf8(rt, error);
+        handler.asObject(rt).asFunction(rt).call(rt, static_cast<double>(id), std::move(message));
+      }
+    });
+  });
+}
+
+TrueSheetCommandQueueHostObject::~TrueSheetCommandQueueHostObject() {
+  TrueSheetCommandQueue::removeOwner(owner_);
+}
+
+jsi::Value TrueSheetCommandQueueHostObject::get(jsi::Runtime &runtime, const jsi::PropNameID &name) {
+  auto propName = name.utf8(runtime);
+
+  if (propName == "apply") {
+    auto owner = owner_;
+    return jsi::Function::createFromHostFunction(
+        runtime, name, 1, [owner](jsi::Runtime &rt, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
+          if (count < 1 || !args[0].isObject() || !args[0].asObject(rt).isArray(rt)) {
+            return 0;
+          }
+
+          auto array = args[0].asObject(rt).asArray(rt);
+          auto length = array.size(rt);
+
+          std::vector<TrueSheetCommand> commands;
+          commands.reserve(length);
+          for (size_t i = 0; i < length; i++) {
+            TrueSheetCommand command;
+            if (commandFromValue(rt, array.getValueAtIndex(rt, i), command)) {
+              command.owner = owner;
+              commands.push_back(command);
+            }
+          }
+
+          TrueSheetCommandQueue::enqueue(commands);
+          return static_cast<double>(commands.size());
+        });
+  }
+
+  return jsi::Value::undefined();
+}
+
+std::vector<jsi::PropNameID> TrueSheetCommandQueueHostObject::getPropertyNames(jsi::Runtime &runtime) {
+  return jsi::PropNameID::names(runtime, "apply");
+}
+
+void TrueSheetCommandQueueHostObject::install(jsi::Runtime &runtime, const std::shared_ptr<CallInvoker> &callInvoker) {
+  auto queue =
+      jsi::Object::createFromHostObject(runtime, std::make_shared<TrueSheetCommandQueueHostObject>(callInvoker));
+  runtime.global().setProperty(runtime, kInstallName, std::move(queue));
+}
+
+} // namespace facebook::react
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <ReactCommon/CallInvoker.h>
+#include <jsi/jsi.h>
+
+#include <memory>
+
+#include <vector>
+
+#include "TrueSheetCommandQueue.h"
+
+namespace facebook::react {
+
+/*
+ * JS entry point of the command queue.
+ * Exposes `apply(commands)`, which synchronously enqueues `{tag, type, index, animated, id}`
+ * entries as one batch and returns how many were queued. Completion is reported per command
+ * through the sheet's `onCommandComplete` event, or through `global.__TrueSheetCommandFailed(id, error)`
+ * when the sheet is gone by the time the command runs.
+ */
+class TrueSheetCommandQueueHostObject final : public jsi::HostObject {
+ public:
+  /*
+   * Registers the runtime with the queue. Commands it queues are failed back through
+   * `callInvoker`, and dropped when the runtime, and with it this object, is torn down.
+   */
+  explicit TrueSheetCommandQueueHostObject(const std::shared_ptr<CallInvoker> &callInvoker);
+  ~TrueSheetCommandQueueHostObject() override;
+
+  jsi::Value get(jsi::Runtime &runtime, const jsi::PropNameID &name) override;
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime &runtime) override;
+
+  /*
+   * Installs `global.__TrueSheetCommands`. The platform sets the queue's scheduler.
+   */
+  static void install(jsi::Runtime &runtime, const std::shared_ptr<CallInvoker> &callInvoker);
+
+ private:
+  int32_t owner_;
+};
+
+} // namespace facebook::react
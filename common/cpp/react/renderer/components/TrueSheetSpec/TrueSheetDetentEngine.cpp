@@ -0,0 +1,313 @@
+#include "TrueSheetDetentEngine.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook::react {
+
+namespace {
+
+// How far ahead a release is projected when deciding whether it dismisses
+constexpr double kDismissProjectionSeconds = 0.1;
+
+} // namespace
+
+void TrueSheetDetentEngine::setDetents(const double *detents, size_t count) {
+  detents_.assign(detents, detents + count);
+  resolverHeights_.assign(count, 0);
+  offsets_.assign(count, 0);
+  rebuildHeights();
+}
+
+size_t TrueSheetDetentEngine::getDetentCount() const noexcept {
+  return detents_.size();
+}
+
+void TrueSheetDetentEngine::setLayout(const TrueSheetDetentLayout &layout) noexcept {
+  if (layout == layout_) {
+    return;
+  }
+
+  layout_ = layout;
+  rebuildHeights();
+}
+
+const TrueSheetDetentLayout &TrueSheetDetentEngine::getLayout() const noexcept {
+  return layout_;
+}
+
+double TrueSheetDetentEngine::getPeekHeight() const noexcept {
+  double height = layout_.headerHeight + layout_.footerHeight + layout_.peekContentHeight;
+  return height > 0 ? height : layout_.peekFallbackHeight;
+}
+
+double TrueSheetDetentEngine::getDetentValue(int index) const noexcept {
+  if (!isValidIndex(index) || layout_.screenHeight <= 0) {
+    return 0;
+  }
+
+  double value = detents_[index];
+  if (value == kAutoDetent) {
+    return (layout_.contentHeight + layout_.headerHeight) / layout_.screenHeight;
+  }
+  if (value == kPeekDetent) {
+    return getPeekHeight() / layout_.screenHeight;
+  }
+  return value;
+}
+
+double TrueSheetDetentEngine::getDetentHeight(double detent, bool includeKeyboard) const noexcept {
+  double baseHeight;
+  if (detent == kAutoDetent) {
+    baseHeight = layout_.contentHeight + layout_.headerHeight;
+  } else if (detent == kPeekDetent) {
+    baseHeight = getPeekHeight();
+  } else if (detent > 0 && detent <= 1) {
+    baseHeight = detent * layout_.screenHeight;
+    if (layout_.integralHeights) {
+      baseHeight = std::floor(baseHeight);
+    }
+  } else {
+    return 0;
+  }
+
+  double height = baseHeight + layout_.bottomInset;
+  if (includeKeyboard) {
+    height += layout_.keyboardInset;
+  }
+
+  height = std::min(height, layout_.screenHeight + layout_.bottomInset);
+  if (layout_.maxContentHeight > 0) {
+    height = std::min(height, layout_.maxContentHeight);
+  }
+  return height;
+}
+
+double TrueSheetDetentEngine::getResolvedHeight(int index) const noexcept {
+  return isValidIndex(index) ? heights_[index] : 0;
+}
+
+double TrueSheetDetentEngine::computeResolvedHeight(int index) const noexcept {
+  double resolverHeight = resolverHeights_[index];
+  if (resolverHeight > 0) {
+    return resolverHeight + getOffset(index);
+  }
+
+  if (layout_.maxDetentHeight > 0) {
+    return getDetentValue(index) * layout_.maxDetentHeight;
+  }
+
+  // Clamp to the space the sheet can actually occupy. A keyboard-inflated
+  // detent height can exceed it while the real sheet stops at the top inset.
+  double containerHeight = layout_.containerHeight > 0 ? layout_.containerHeight : layout_.screenHeight;
+  return std::min(getDetentHeight(detents_[index]), containerHeight - layout_.topInset);
+}
+
+void TrueSheetDetentEngine::setResolverHeight(int index, double height) noexcept {
+  if (isValidIndex(index) && resolverHeights_[index] != height) {
+    resolverHeights_[index] = height;
+    rebuildHeights();
+  }
+}
+
+void TrueSheetDetentEngine::learnOffset(int index, double actualHeight) noexcept {
+  if (!isValidIndex(index)) {
+    return;
+  }
+
+  double resolverHeight = resolverHeights_[index];
+  // Always update — system offset can change between detent transitions
+  if (resolverHeight > 0 && actualHeight > 0 && offsets_[index] != actualHeight - resolverHeight) {
+    offsets_[index] = actualHeight - resolverHeight;
+    // Offsets fall back across detents, so every entry may change
+    rebuildHeights();
+  }
+}
+
+void TrueSheetDetentEngine::clearResolvedHeights() noexcept {
+  std::fill(resolverHeights_.begin(), resolverHeights_.end(), 0);
+  std::fill(offsets_.begin(), offsets_.end(), 0);
+  rebuildHeights();
+}
+
+void TrueSheetDetentEngine::rebuildHeights() noexcept {
+  int count = static_cast<int>(detents_.size());
+  heights_.resize(count);
+  ascending_ = true;
+  for (int i = 0; i < count; i++) {
+    heights_[i] = computeResolvedHeight(i);
+    if (i > 0 && heights_[i] < heights_[i - 1]) {
+      ascending_ = false;
+    }
+  }
+}
+
+TrueSheetDetentSegment TrueSheetDetentEngine::findSegment(double sheetHeight) const noexcept {
+  int count = static_cast<int>(detents_.size());
+  if (count == 0) {
+    return {};
+  }
+
+  double firstHeight = heights_[0];
+
+  // Below first detent - interpolating toward closed
+  if (sheetHeight < firstHeight) {
+    double progress = firstHeight > 0 ? (firstHeight - sheetHeight) / firstHeight : 0;
+    return {-1, 0, progress, false};
+  }
+
+  if (count == 1) {
+    return {0, 0, 0, false};
+  }
+
+  // Above last detent
+  if (sheetHeight > heights_[count - 1]) {
+    return {count - 1, count - 1, 0, false};
+  }
+
+  if (!ascending_) {
+    return findSegmentLinear(sheetHeight);
+  }
+
+  // First detent at or above the sheet height. Equal-height runs (keyboard growth can
+  // clamp adjacent detents to the same height) resolve to the same index as a linear scan.
+  auto lower = std::lower_bound(heights_.begin(), heights_.end(), sheetHeight);
+  int index = static_cast<int>(lower - heights_.begin());
+
+  if (index == 0) {
+    int last = static_cast<int>(std::upper_bound(heights_.begin(), heights_.end(), sheetHeight) - heights_.begin()) - 1;
+    if (last == count - 1) {
+      return {count - 1, count - 1, 0, false};
+    }
+    return {last, last + 1, 0, true};
+  }
+
+  double height = heights_[index - 1];
+  double nextHeight = heights_[index];
+  double progress = (sheetHeight - height) / (nextHeight - height);
+  return {index - 1, index, std::clamp(progress, 0.0, 1.0), true};
+}
+
+TrueSheetDetentSegment TrueSheetDetentEngine::findSegmentLinear(double sheetHeight) const noexcept {
+  int count = static_cast<int>(heights_.size());
+  for (int i = 0; i < count - 1; i++) {
+    double height = heights_[i];
+    double nextHeight = heights_[i + 1];
+
+    // Skip degenerate segments — keyboard growth can clamp adjacent detents
+    // to the same height; falling through reports the topmost detent
+    if (height == nextHeight) {
+      continue;
+    }
+
+    if (sheetHeight >= height && sheetHeight <= nextHeight) {
+      double progress = (sheetHeight - height) / (nextHeight - height);
+      return {i, i + 1, std::clamp(progress, 0.0, 1.0), true};
+    }
+  }
+
+  return {count - 1, count - 1, 0, false};
+}
+
+double TrueSheetDetentEngine::getInterpolatedIndex(double sheetHeight) const noexcept {
+  if (detents_.empty()) {
+    return -1;
+  }
+
+  TrueSheetDetentSegment segment = findSegment(sheetHeight);
+  if (segment.fromIndex == -1) {
+    return -segment.progress;
+  }
+  return segment.fromIndex + segment.progress;
+}
+
+double TrueSheetDetentEngine::getInterpolatedDetent(double sheetHeight) const noexcept {
+  if (detents_.empty()) {
+    return 0;
+  }
+
+  TrueSheetDetentSegment segment = findSegment(sheetHeight);
+  if (segment.fromIndex == -1) {
+    return std::max(0.0, getDetentValue(0) * (1 - segment.progress));
+  }
+  if (!segment.between) {
+    return getDetentValue(segment.fromIndex);
+  }
+
+  double detent = getDetentValue(segment.fromIndex);
+  double nextDetent = getDetentValue(segment.toIndex);
+  return detent + segment.progress * (nextDetent - detent);
+}
+
+int TrueSheetDetentEngine::predictSettleIndex(const TrueSheetSettleRelease &release) const noexcept {
+  int count = static_cast<int>(heights_.size());
+  if (count == 0) {
+    return -1;
+  }
+
+  int minIndex = std::clamp(release.minIndex, 0, count - 1);
+  int maxIndex = std::clamp(release.maxIndex, minIndex, count - 1);
+  double sheetHeight = release.sheetHeight;
+  double velocity = release.velocity;
+
+  if (release.dismissible && minIndex == 0) {
+    double projectedHeight = sheetHeight + velocity * kDismissProjectionSeconds;
+    if (projectedHeight < heights_[0] / 2) {
+      return -1;
+    }
+  }
+
+  bool atRest = velocity == 0 || std::abs(velocity) < release.restVelocity;
+
+  // Heights are scanned linearly — keyboard growth can leave them unordered
+  int nearest = minIndex;
+  int lowest = minIndex;
+  int highest = minIndex;
+  int next = -1;
+  for (int i = minIndex; i <= maxIndex; i++) {
+    double height = heights_[i];
+    if (std::abs(height - sheetHeight) < std::abs(heights_[nearest] - sheetHeight)) {
+      nearest = i;
+    }
+    if (height < heights_[lowest]) {
+      lowest = i;
+    }
+    if (height > heights_[highest]) {
+      highest = i;
+    }
+
+    // Closest detent beyond the sheet height in the release direction
+    bool ahead = velocity > 0 ? height > sheetHeight : height < sheetHeight;
+    if (ahead && (next == -1 || std::abs(height - sheetHeight) < std::abs(heights_[next] - sheetHeight))) {
+      next = i;
+    }
+  }
+
+  if (atRest) {
+    return nearest;
+  }
+  if (next != -1) {
+    return next;
+  }
+  return velocity > 0 ? highest : lowest;
+}
+
+double TrueSheetDetentEngine::getOffset(int index) const noexcept {
+  // Use this detent's own offset if learned, otherwise fall back to any known offset
+  if (offsets_[index] != 0) {
+    return offsets_[index];
+  }
+
+  for (double offset : offsets_) {
+    if (offset != 0) {
+      return offset;
+    }
+  }
+  return 0;
+}
+
+bool TrueSheetDetentEngine::isValidIndex(int index) const noexcept {
+  return index >= 0 && index < static_cast<int>(detents_.size());
+}
+
+} // namespace facebook::react
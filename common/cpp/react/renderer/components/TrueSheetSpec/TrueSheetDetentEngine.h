@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Measurements the detent engine resolves heights against.
+ * Values share the platform unit — points on iOS, pixels on Android.
+ */
+struct TrueSheetDetentLayout {
+  // Height that detent fractions are relative to
+  double screenHeight{0};
+  // Height sheet positions are measured from. Falls back to `screenHeight`.
+  double containerHeight{0};
+  double contentHeight{0};
+  double headerHeight{0};
+  double footerHeight{0};
+  double peekContentHeight{0};
+  // Used for peek (-2) detents when header, footer and peek content are empty
+  double peekFallbackHeight{150};
+  double bottomInset{0};
+  double keyboardInset{0};
+  double topInset{0};
+  // Upper bound for detent heights. Ignored when <= 0.
+  double maxContentHeight{0};
+  // System-resolved maximum height (iOS). When set, unresolved detents scale against it.
+  double maxDetentHeight{0};
+  // Truncate fraction heights to whole units (Android pixels)
+  bool integralHeights{false};
+
+  bool operator==(const TrueSheetDetentLayout &other) const = default;
+};
+
+/*
+ * Segment of the detent list that a sheet height falls into.
+ */
+struct TrueSheetDetentSegment {
+  // Lower detent index of the segment, -1 when below the first detent
+  int fromIndex{-1};
+  int toIndex{0};
+  // Progress within the segment (0-1). Below the first detent, progress toward closed.
+  double progress{0};
+  // True when the height lies between two distinct detents
+  bool between{false};
+};
+
+/*
+ * State of a drag at release, used to predict where the sheet settles.
+ */
+struct TrueSheetSettleRelease {
+  double sheetHeight{0};
+  // Release velocity in height units per second, positive when the sheet grows
+  double velocity{0};
+  // Releases slower than this settle at the nearest detent instead of moving on
+  double restVelocity{0};
+  // Detent range reachable in one drag
+  int minIndex{0};
+  int maxIndex{std::numeric_limits<int>::max()};
+  // Whether a release below the first detent may dismiss the sheet
+  bool dismissible{false};
+};
+
+/*
+ * Shared detent math for iOS and Android.
+ * Detent values, resolver heights and learned offsets live in flat arrays that are
+ * only resized when detents change, so per-frame lookups never allocate.
+ * Resolved heights are kept in a table that is rebuilt only when detents, layout or
+ * resolver heights change; segment lookups binary-search it.
+ */
+class TrueSheetDetentEngine final {
+ public:
+  static constexpr double kAutoDetent = -1;
+  static constexpr double kPeekDetent = -2;
+
+  void setDetents(const double *detents, size_t count);
+  size_t getDetentCount() const noexcept;
+
+  /*
+   * Updates measurements. The height table is only rebuilt when a value differs.
+   */
+  void setLayout(const TrueSheetDetentLayout &layout) noexcept;
+  const TrueSheetDetentLayout &getLayout() const noexcept;
+
+  /*
+   * Height for peek (-2) detents: header + footer + peek content height.
+   */
+  double getPeekHeight() const noexcept;
+
+  /*
+   * Screen fraction for a detent index. Auto and peek detents resolve against content.
+   */
+  double getDetentValue(int index) const noexcept;
+
+  /*
+   * Sheet height for a raw detent value, including the bottom inset and optionally the keyboard.
+   */
+  double getDetentHeight(double detent, bool includeKeyboard = true) const noexcept;
+
+  /*
+   * Expected sheet height at a detent index: the system-resolved height plus the learned
+   * offset when known, otherwise the computed detent height clamped to the container.
+   */
+  double getResolvedHeight(int index) const noexcept;
+
+  void setResolverHeight(int index, double height) noexcept;
+
+  /*
+   * Learns the offset between the resolver height and the actual presented height.
+   */
+  void learnOffset(int index, double actualHeight) noexcept;
+
+  void clearResolvedHeights() noexcept;
+
+  /*
+   * O(log n) when resolved heights are ascending; falls back to a linear scan otherwise.
+   */
+  TrueSheetDetentSegment findSegment(double sheetHeight) const noexcept;
+
+  /*
+   * Continuous index for a sheet height (e.g. 0.5 is halfway between detent 0 and 1,
+   * -0.3 is 30% toward closed from detent 0).
+   */
+  double getInterpolatedIndex(double sheetHeight) const noexcept;
+
+  /*
+   * Interpolated screen fraction for a sheet height.
+   */
+  double getInterpolatedDetent(double sheetHeight) const noexcept;
+
+  /*
+   * Detent index a released drag is expected to settle at, or -1 when it is expected to dismiss.
+   * A moving release continues to the next detent in its direction; a release at rest snaps to
+   * the nearest one. The sheet dismisses when its height, projected a short time ahead, falls
+   * below half of the first detent.
+   */
+  int predictSettleIndex(const TrueSheetSettleRelease &release) const noexcept;
+
+ private:
+  double getOffset(int index) const noexcept;
+  double computeResolvedHeight(int index) const noexcept;
+  void rebuildHeights() noexcept;
+  TrueSheetDetentSegment findSegmentLinear(double sheetHeight) const noexcept;
+  bool isValidIndex(int index) const noexcept;
+
+  std::vector<double> detents_;
+  std::vector<double> resolverHeights_;
+  std::vector<double> offsets_;
+  // Resolved height per detent index, see `rebuildHeights`
+  std::vector<double> heights_;
+  // True when `heights_` is non-decreasing, enabling binary search
+  bool ascending_{true};
+  TrueSheetDetentLayout layout_;
+};
+
+} // namespace facebook::react
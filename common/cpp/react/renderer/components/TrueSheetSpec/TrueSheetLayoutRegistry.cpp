@@ -0,0 +1,54 @@
+#include "TrueSheetLayoutRegistry.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+struct Entry {
+  double height{TrueSheetLayoutRegistry::kUnknownHeight};
+  Tag scrollViewTag{TrueSheetLayoutRegistry::kUnknownScrollView};
+};
+
+std::mutex &registryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_map<Tag, Entry> &registry() {
+  static std::unordered_map<Tag, Entry> entries;
+  return entries;
+}
+
+} // namespace
+
+void TrueSheetLayoutRegistry::setHeight(Tag tag, double height) {
+  std::lock_guard<std::mutex> lock(registryMutex());
+  registry()[tag].height = height;
+}
+
+double TrueSheetLayoutRegistry::getHeight(Tag tag) {
+  std::lock_guard<std::mutex> lock(registryMutex());
+  auto it = registry().find(tag);
+  return it != registry().end() ? it->second.height : kUnknownHeight;
+}
+
+void TrueSheetLayoutRegistry::setScrollViewTag(Tag tag, Tag scrollViewTag) {
+  std::lock_guard<std::mutex> lock(registryMutex());
+  registry()[tag].scrollViewTag = scrollViewTag;
+}
+
+Tag TrueSheetLayoutRegistry::getScrollViewTag(Tag tag) {
+  std::lock_guard<std::mutex> lock(registryMutex());
+  auto it = registry().find(tag);
+  return it != registry().end() ? it->second.scrollViewTag : kUnknownScrollView;
+}
+
+void TrueSheetLayoutRegistry::remove(Tag tag) {
+  std::lock_guard<std::mutex> lock(registryMutex());
+  registry().erase(tag);
+}
+
+} // namespace facebook::react
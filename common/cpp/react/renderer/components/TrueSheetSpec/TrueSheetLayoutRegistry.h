@@ -0,0 +1,44 @@
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+
+namespace facebook::react {
+
+/*
+ * Layout facts about sheet content, header and footer views, published by their shadow nodes
+ * when Yoga lays them out during commit. Native reads them before the views are mounted,
+ * so auto and peek detents resolve against the exact layout on the first present.
+ * Heights are in layout points (dp on Android).
+ */
+class TrueSheetLayoutRegistry final {
+ public:
+  static constexpr double kUnknownHeight = -1;
+  static constexpr Tag kUnknownScrollView = -1;
+  static constexpr Tag kNoScrollView = 0;
+
+  static void setHeight(Tag tag, double height);
+
+  /*
+   * Last published height for the view, or `kUnknownHeight`.
+   */
+  static double getHeight(Tag tag);
+
+  /*
+   * Content views publish the first ScrollView in their subtree, so native can look it up
+   * without walking the mounted views.
+   */
+  static void setScrollViewTag(Tag tag, Tag scrollViewTag);
+
+  /*
+   * Last published ScrollView tag for the content view, `kNoScrollView` when it has none,
+   * or `kUnknownScrollView` before its first layout.
+   */
+  static Tag getScrollViewTag(Tag tag);
+
+  /*
+   * Called by native when the view is recycled or dropped.
+   */
+  static void remove(Tag tag);
+};
+
+} // namespace facebook::react
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <react/renderer/components/TrueSheetSpec/TrueSheetMeasuredViewShadowNode.h>
+#include <react/renderer/core/ConcreteComponentDescriptor.h>
+
+namespace facebook::react {
+
+/*
+ * Descriptors for <TrueSheetContentView>, <TrueSheetHeaderView> and <TrueSheetFooterView>.
+ */
+using TrueSheetContentViewComponentDescriptor = ConcreteComponentDescriptor<TrueSheetContentViewShadowNode>;
+using TrueSheetHeaderViewComponentDescriptor = ConcreteComponentDescriptor<TrueSheetHeaderViewShadowNode>;
+using TrueSheetFooterViewComponentDescriptor = ConcreteComponentDescriptor<TrueSheetFooterViewShadowNode>;
+
+} // namespace facebook::react
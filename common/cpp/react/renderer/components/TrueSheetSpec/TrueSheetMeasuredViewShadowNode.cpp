@@ -0,0 +1,30 @@
+#include "TrueSheetMeasuredViewShadowNode.h"
+
+#include <cstring>
+
+namespace facebook::react {
+
+extern const char TrueSheetContentViewComponentName[] = "TrueSheetContentView";
+extern const char TrueSheetHeaderViewComponentName[] = "TrueSheetHeaderView";
+extern const char TrueSheetFooterViewComponentName[] = "TrueSheetFooterView";
+
+Tag findTrueSheetScrollViewTag(const ShadowNode &node) {
+  for (const auto &child : node.getChildren()) {
+    const char *componentName = child->getComponentName();
+    if (std::strcmp(componentName, "ScrollView") == 0) {
+      return child->getTag();
+    }
+    // A nested sheet owns its own scroll view
+    if (std::strcmp(componentName, "TrueSheetView") == 0) {
+      continue;
+    }
+
+    Tag tag = findTrueSheetScrollViewTag(*child);
+    if (tag != TrueSheetLayoutRegistry::kNoScrollView) {
+      return tag;
+    }
+  }
+  return TrueSheetLayoutRegistry::kNoScrollView;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <jsi/jsi.h>
+#include <react/renderer/components/TrueSheetSpec/EventEmitters.h>
+#include <react/renderer/components/TrueSheetSpec/Props.h>
+#include <react/renderer/components/TrueSheetSpec/TrueSheetLayoutRegistry.h>
+#include <react/renderer/components/view/ConcreteViewShadowNode.h>
+
+namespace facebook::react {
+
+JSI_EXPORT extern const char TrueSheetContentViewComponentName[];
+JSI_EXPORT extern const char TrueSheetHeaderViewComponentName[];
+JSI_EXPORT extern const char TrueSheetFooterViewComponentName[];
+
+/*
+ * Tag of the first ScrollView under `node` in mount order, skipping nested sheets,
+ * or `TrueSheetLayoutRegistry::kNoScrollView`.
+ */
+Tag findTrueSheetScrollViewTag(const ShadowNode &node);
+
+/*
+ * `ShadowNode` for the sheet's content, header and footer views.
+ * Publishes the Yoga-measured height to `TrueSheetLayoutRegistry` whenever the node
+ * receives a new layout, so native knows the sizes before mounting. The content view also
+ * publishes its ScrollView. The lookup is cached per children revision and the registry is
+ * only written when the result changes, so layouts that keep the same subtree skip both.
+ */
+template <const char *concreteComponentName, typename ViewPropsT, typename ViewEventEmitterT>
+class JSI_EXPORT TrueSheetMeasuredViewShadowNode final
+    : public ConcreteViewShadowNode<concreteComponentName, ViewPropsT, ViewEventEmitterT> {
+  using Base = ConcreteViewShadowNode<concreteComponentName, ViewPropsT, ViewEventEmitterT>;
+  using Base::Base;
+
+ public:
+  TrueSheetMeasuredViewShadowNode(const ShadowNode &sourceShadowNode, const ShadowNodeFragment &fragment)
+      : Base(sourceShadowNode, fragment) {
+    const auto &source = static_cast<const TrueSheetMeasuredViewShadowNode &>(sourceShadowNode);
+
+    // Clones that keep the children keep the whole subtree, since changing any descendant
+    // clones every ancestor with new children
+    childrenRevision_ = source.childrenRevision_ + (fragment.children ? 1 : 0);
+    scrollViewTag_ = source.scrollViewTag_;
+    scrollViewTagRevision_ = source.scrollViewTagRevision_;
+  }
+
+  void layout(LayoutContext layoutContext) override {
+    Base::layout(layoutContext);
+    TrueSheetLayoutRegistry::setHeight(this->getTag(), this->getLayoutMetrics().frame.size.height);
+
+    if constexpr (concreteComponentName == TrueSheetContentViewComponentName) {
+      if (scrollViewTagRevision_ == childrenRevision_) {
+        return;
+      }
+
+      Tag scrollViewTag = findTrueSheetScrollViewTag(*this);
+      if (scrollViewTag != scrollViewTag_) {
+        scrollViewTag_ = scrollViewTag;
+        TrueSheetLayoutRegistry::setScrollViewTag(this->getTag(), scrollViewTag);
+      }
+      scrollViewTagRevision_ = childrenRevision_;
+    }
+  }
+
+ private:
+  // Bumped by clones that replace the children
+  int childrenRevision_{0};
+
+  // Last published ScrollView and the children revision it was looked up for
+  Tag scrollViewTag_{TrueSheetLayoutRegistry::kUnknownScrollView};
+  int scrollViewTagRevision_{-1};
+};
+
+using TrueSheetContentViewShadowNode = TrueSheetMeasuredViewShadowNode<
+    TrueSheetContentViewComponentName,
+    TrueSheetContentViewProps,
+    TrueSheetContentViewEventEmitter>;
+
+using TrueSheetHeaderViewShadowNode = TrueSheetMeasuredViewShadowNode<
+    TrueSheetHeaderViewComponentName,
+    TrueSheetHeaderViewProps,
+    TrueSheetHeaderViewEventEmitter>;
+
+using TrueSheetFooterViewShadowNode = TrueSheetMeasuredViewShadowNode<
+    TrueSheetFooterViewComponentName,
+    TrueSheetFooterViewProps,
+    TrueSheetFooterViewEventEmitter>;
+
+} // namespace facebook::react
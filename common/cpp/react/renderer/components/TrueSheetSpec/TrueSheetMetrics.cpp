@@ -0,0 +1,171 @@
+#include "TrueSheetMetrics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook::react {
+
+namespace {
+
+double bucketUpperBound(size_t bucket) {
+  return std::ldexp(1.0, static_cast<int>(bucket));
+}
+
+size_t bucketForLatency(double ms) {
+  for (size_t bucket = 0; bucket < TrueSheetLatencyHistogram::kBucketCount - 1; bucket++) {
+    if (ms <= bucketUpperBound(bucket)) {
+      return bucket;
+    }
+  }
+  return TrueSheetLatencyHistogram::kBucketCount - 1;
+}
+
+void addRelaxed(std::atomic<double> &value, double delta) {
+  double current = value.load(std::memory_order_relaxed);
+  while (!value.compare_exchange_weak(current, current + delta, std::memory_order_relaxed)) {
+  }
+}
+
+} // namespace
+
+folly::dynamic TrueSheetLatencySummary::getDynamic() const {
+  return folly::dynamic::object("count", static_cast<double>(count))("mean", mean)("min", min)("max", max)(
+      "p50", p50)("p90", p90)("p99", p99);
+}
+
+folly::dynamic TrueSheetMetricsSnapshot::getDynamic() const {
+  return folly::dynamic::object("presentLatency", presentLatency.getDynamic())(
+      "dismissLatency", dismissLatency.getDynamic())("positionEventsEmitted", static_cast<double>(positionEventsEmitted))(
+      "positionEventsCoalesced", static_cast<double>(positionEventsCoalesced))(
+      "stateUpdates", static_cast<double>(stateUpdates))(
+      "detentReconfigurations", static_cast<double>(detentReconfigurations))(
+      "propTransactions", static_cast<double>(propTransactions))(
+      "reconfigurationStages", static_cast<double>(reconfigurationStages));
+}
+
+void TrueSheetLatencyHistogram::record(double ms) noexcept {
+  if (!std::isfinite(ms) || ms < 0) {
+    return;
+  }
+
+  buckets_[bucketForLatency(ms)].fetch_add(1, std::memory_order_relaxed);
+  addRelaxed(sum_, ms);
+
+  // The first sample seeds min and max
+  if (count_.fetch_add(1, std::memory_order_relaxed) == 0) {
+    min_.store(ms, std::memory_order_relaxed);
+    max_.store(ms, std::memory_order_relaxed);
+    return;
+  }
+
+  double min = min_.load(std::memory_order_relaxed);
+  while (ms < min && !min_.compare_exchange_weak(min, ms, std::memory_order_relaxed)) {
+  }
+  double max = max_.load(std::memory_order_relaxed);
+  while (ms > max && !max_.compare_exchange_weak(max, ms, std::memory_order_relaxed)) {
+  }
+}
+
+TrueSheetLatencySummary TrueSheetLatencyHistogram::summarize() const noexcept {
+  TrueSheetLatencySummary summary;
+  summary.count = count_.load(std::memory_order_relaxed);
+  if (summary.count == 0) {
+    return summary;
+  }
+
+  summary.min = min_.load(std::memory_order_relaxed);
+  summary.max = max_.load(std::memory_order_relaxed);
+  summary.mean = sum_.load(std::memory_order_relaxed) / static_cast<double>(summary.count);
+  summary.p50 = estimatePercentile(0.5, summary.count, summary.min, summary.max);
+  summary.p90 = estimatePercentile(0.9, summary.count, summary.min, summary.max);
+  summary.p99 = estimatePercentile(0.99, summary.count, summary.min, summary.max);
+  return summary;
+}
+
+double TrueSheetLatencyHistogram::estimatePercentile(double percentile, uint64_t count, double min, double max)
+    const noexcept {
+  auto rank = static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(count)));
+  uint64_t seen = 0;
+
+  for (size_t bucket = 0; bucket < kBucketCount - 1; bucket++) {
+    uint64_t bucketCount = buckets_[bucket].load(std::memory_order_relaxed);
+    if (seen + bucketCount >= rank && bucketCount > 0) {
+      // Interpolate linearly within the bucket
+      double lower = bucket == 0 ? 0 : bucketUpperBound(bucket - 1);
+      double fraction = static_cast<double>(rank - seen) / static_cast<double>(bucketCount);
+      return std::clamp(lower + (bucketUpperBound(bucket) - lower) * fraction, min, max);
+    }
+    seen += bucketCount;
+  }
+  return max;
+}
+
+void TrueSheetLatencyHistogram::reset() noexcept {
+  for (auto &bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store(0, std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+TrueSheetMetrics &TrueSheetMetrics::shared() noexcept {
+  static TrueSheetMetrics metrics;
+  return metrics;
+}
+
+void TrueSheetMetrics::recordPresentLatency(double ms) noexcept {
+  presentLatency_.record(ms);
+}
+
+void TrueSheetMetrics::recordDismissLatency(double ms) noexcept {
+  dismissLatency_.record(ms);
+}
+
+void TrueSheetMetrics::recordPositionEmitted() noexcept {
+  positionEventsEmitted_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TrueSheetMetrics::recordPositionCoalesced() noexcept {
+  positionEventsCoalesced_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TrueSheetMetrics::recordStateUpdate() noexcept {
+  stateUpdates_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TrueSheetMetrics::recordDetentReconfiguration() noexcept {
+  detentReconfigurations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TrueSheetMetrics::recordPropTransaction(uint64_t stages) noexcept {
+  propTransactions_.fetch_add(1, std::memory_order_relaxed);
+  reconfigurationStages_.fetch_add(stages, std::memory_order_relaxed);
+}
+
+TrueSheetMetricsSnapshot TrueSheetMetrics::snapshot() const noexcept {
+  TrueSheetMetricsSnapshot snapshot;
+  snapshot.presentLatency = presentLatency_.summarize();
+  snapshot.dismissLatency = dismissLatency_.summarize();
+  snapshot.positionEventsEmitted = positionEventsEmitted_.load(std::memory_order_relaxed);
+  snapshot.positionEventsCoalesced = positionEventsCoalesced_.load(std::memory_order_relaxed);
+  snapshot.stateUpdates = stateUpdates_.load(std::memory_order_relaxed);
+  snapshot.detentReconfigurations = detentReconfigurations_.load(std::memory_order_relaxed);
+  snapshot.propTransactions = propTransactions_.load(std::memory_order_relaxed);
+  snapshot.reconfigurationStages = reconfigurationStages_.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+void TrueSheetMetrics::reset() noexcept {
+  presentLatency_.reset();
+  dismissLatency_.reset();
+  positionEventsEmitted_.store(0, std::memory_order_relaxed);
+  positionEventsCoalesced_.store(0, std::memory_order_relaxed);
+  stateUpdates_.store(0, std::memory_order_relaxed);
+  detentReconfigurations_.store(0, std::memory_order_relaxed);
+  propTransactions_.store(0, std::memory_order_relaxed);
+  reconfigurationStages_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace facebook::react {
+
+/*
+ * Summary of a latency histogram, in milliseconds.
+ * Percentiles are interpolated within buckets and clamped to the observed range.
+ */
+struct TrueSheetLatencySummary {
+  uint64_t count{0};
+  double mean{0};
+  double min{0};
+  double max{0};
+  double p50{0};
+  double p90{0};
+  double p99{0};
+
+  folly::dynamic getDynamic() const;
+};
+
+struct TrueSheetMetricsSnapshot {
+  // `present` call to `onDidPresent`
+  TrueSheetLatencySummary presentLatency;
+  // `dismiss` call (or swipe release) to `onDidDismiss`
+  TrueSheetLatencySummary dismissLatency;
+  uint64_t positionEventsEmitted{0};
+  // Samples replaced by a newer one before reaching JS
+  uint64_t positionEventsCoalesced{0};
+  // Container size updates committed to the shadow tree
+  uint64_t stateUpdates{0};
+  // `setupSheetDetents` passes
+  uint64_t detentReconfigurations{0};
+  // Prop transactions on presented sheets, and the reconfiguration stages they ran
+  uint64_t propTransactions{0};
+  uint64_t reconfigurationStages{0};
+
+  folly::dynamic getDynamic() const;
+};
+
+/*
+ * Fixed-bucket latency histogram. Recording never locks or allocates.
+ */
+class TrueSheetLatencyHistogram final {
+ public:
+  // Upper bounds double from 1ms; the last bucket catches everything above
+  static constexpr size_t kBucketCount = 15;
+
+  void record(double ms) noexcept;
+  TrueSheetLatencySummary summarize() const noexcept;
+  void reset() noexcept;
+
+ private:
+  double estimatePercentile(double percentile, uint64_t count, double min, double max) const noexcept;
+
+  std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<double> sum_{0};
+  std::atomic<double> min_{0};
+  std::atomic<double> max_{0};
+};
+
+/*
+ * Process-wide performance counters shared by every sheet.
+ * Written from the UI thread and read from JS through `TrueSheetModule.getMetrics()`;
+ * counters are relaxed atomics, so a snapshot taken mid-update may be off by one sample.
+ */
+class TrueSheetMetrics final {
+ public:
+  static TrueSheetMetrics &shared() noexcept;
+
+  void recordPresentLatency(double ms) noexcept;
+  void recordDismissLatency(double ms) noexcept;
+  void recordPositionEmitted() noexcept;
+  void recordPositionCoalesced() noexcept;
+  void recordStateUpdate() noexcept;
+  void recordDetentReconfiguration() noexcept;
+  void recordPropTransaction(uint64_t stages) noexcept;
+
+  TrueSheetMetricsSnapshot snapshot() const noexcept;
+  void reset() noexcept;
+
+ private:
+  TrueSheetLatencyHistogram presentLatency_;
+  TrueSheetLatencyHistogram dismissLatency_;
+  std::atomic<uint64_t> positionEventsEmitted_{0};
+  std::atomic<uint64_t> positionEventsCoalesced_{0};
+  std::atomic<uint64_t> stateUpdates_{0};
+  std::atomic<uint64_t> detentReconfigurations_{0};
+  std::atomic<uint64_t> propTransactions_{0};
+  std::atomic<uint64_t> reconfigurationStages_{0};
+};
+
+} // namespace facebook::react
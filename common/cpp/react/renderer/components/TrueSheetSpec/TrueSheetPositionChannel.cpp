@@ -0,0 +1,135 @@
+#include "TrueSheetPositionChannel.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+void TrueSheetPositionChannel::write(const TrueSheetPositionSample &sample) noexcept {
+  uint64_t sequence = sequence_.load(std::memory_order_relaxed) + 1;
+  Slot &slot = slots_[(sequence - 1) % kCapacity];
+
+  slot.version.store(sequence * 2 - 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.index.store(sample.index, std::memory_order_relaxed);
+  slot.position.store(sample.position, std::memory_order_relaxed);
+  slot.detent.store(sample.detent, std::memory_order_relaxed);
+  slot.timestamp.store(sample.timestamp, std::memory_order_relaxed);
+  slot.realtime.store(sample.realtime, std::memory_order_relaxed);
+
+  slot.version.store(sequence * 2, std::memory_order_release);
+  sequence_.store(sequence, std::memory_order_release);
+}
+
+uint64_t TrueSheetPositionChannel::getSequence() const noexcept {
+  return sequence_.load(std::memory_order_acquire);
+}
+
+bool TrueSheetPositionChannel::readLatest(TrueSheetPositionSample &out, uint64_t &outSequence) const noexcept {
+  // Only fails if the producer laps the whole ring mid-read; retry with the new head
+  for (;;) {
+    uint64_t sequence = getSequence();
+    if (sequence == 0) {
+      return false;
+    }
+    if (read(sequence, out)) {
+      outSequence = sequence;
+      return true;
+    }
+  }
+}
+
+bool TrueSheetPositionChannel::read(uint64_t sequence, TrueSheetPositionSample &out) const noexcept {
+  if (sequence == 0) {
+    return false;
+  }
+
+  const Slot &slot = slots_[(sequence - 1) % kCapacity];
+  uint64_t expected = sequence * 2;
+
+  if (slot.version.load(std::memory_order_acquire) != expected) {
+    return false;
+  }
+
+  TrueSheetPositionSample sample;
+  sample.index = slot.index.load(std::memory_order_relaxed);
+  sample.position = slot.position.load(std::memory_order_relaxed);
+  sample.detent = slot.detent.load(std::memory_order_relaxed);
+  sample.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+  sample.realtime = slot.realtime.load(std::memory_order_relaxed);
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (slot.version.load(std::memory_order_relaxed) != expected) {
+    // Overwritten while reading
+    return false;
+  }
+
+  out = sample;
+  return true;
+}
+
+uint64_t TrueSheetPositionCursor::seekLatest(const TrueSheetPositionChannel &channel) noexcept {
+  channel_ = &channel;
+  if (!channel.readLatest(sample_, sequence_)) {
+    sample_ = {};
+    sequence_ = 0;
+  }
+  return sequence_;
+}
+
+bool TrueSheetPositionCursor::seek(const TrueSheetPositionChannel &channel, uint64_t sequence) noexcept {
+  TrueSheetPositionSample sample;
+  if (!channel.read(sequence, sample)) {
+    return false;
+  }
+
+  channel_ = &channel;
+  sample_ = sample;
+  sequence_ = sequence;
+  return true;
+}
+
+bool TrueSheetPositionCursor::isAt(const TrueSheetPositionChannel &channel) const noexcept {
+  return channel_ == &channel;
+}
+
+uint64_t TrueSheetPositionCursor::getSequence() const noexcept {
+  return sequence_;
+}
+
+const TrueSheetPositionSample &TrueSheetPositionCursor::getSample() const noexcept {
+  return sample_;
+}
+
+namespace {
+
+std::mutex &registryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_map<int, std::shared_ptr<TrueSheetPositionChannel>> &registry() {
+  static std::unordered_map<int, std::shared_ptr<TrueSheetPositionChannel>> channels;
+  return channels;
+}
+
+} // namespace
+
+void TrueSheetPositionChannelRegistry::registerChannel(int tag, std::shared_ptr<TrueSheetPositionChannel> channel) {
+  std::lock_guard<std::mutex> lock(registryMutex());
+  registry()[tag] = std::move(channel);
+}
+
+void TrueSheetPositionChannelRegistry::unregisterChannel(int tag) {
+  std::lock_guard<std::mutex> lock(registryMutex());
+  registry().erase(tag);
+}
+
+std::shared_ptr<TrueSheetPositionChannel> TrueSheetPositionChannelRegistry::getChannel(int tag) {
+  std::lock_guard<std::mutex> lock(registryMutex());
+  auto it = registry().find(tag);
+  return it != registry().end() ? it->second : nullptr;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace facebook::react {
+
+struct TrueSheetPositionSample {
+  double index{0};
+  double position{0};
+  double detent{0};
+  double timestamp{0};
+  // False for positions the sheet jumps to without tracking the movement (e.g. after a
+  // size change); consumers animate to those instead of applying them directly
+  bool realtime{true};
+};
+
+/*
+ * Single-producer ring of position samples shared between the UI thread and JS.
+ * The producer never locks, allocates or waits; readers on any thread (JS, worklet runtime)
+ * read the newest sample or catch up on recent ones by sequence. When a reader falls more than
+ * `kCapacity` samples behind, older samples are overwritten and reported as missing.
+ */
+class TrueSheetPositionChannel final {
+ public:
+  static constexpr size_t kCapacity = 64;
+
+  /*
+   * Producer only. Publishes the sample as sequence `getSequence() + 1`.
+   */
+  void write(const TrueSheetPositionSample &sample) noexcept;
+
+  /*
+   * Sequence of the newest sample, 0 before the first write.
+   */
+  uint64_t getSequence() const noexcept;
+
+  /*
+   * Reads the newest sample. Returns false when nothing has been written yet.
+   */
+  bool readLatest(TrueSheetPositionSample &out, uint64_t &outSequence) const noexcept;
+
+  /*
+   * Reads the sample with the given sequence. Returns false when it has not been written
+   * yet or was already overwritten.
+   */
+  bool read(uint64_t sequence, TrueSheetPositionSample &out) const noexcept;
+
+ private:
+  /*
+   * Seqlock-guarded slot. `version` is odd while the producer writes it,
+   * otherwise twice the sequence of the sample it holds.
+   */
+  struct Slot {
+    std::atomic<uint64_t> version{0};
+    std::atomic<double> index{0};
+    std::atomic<double> position{0};
+    std::atomic<double> detent{0};
+    std::atomic<double> timestamp{0};
+    std::atomic<bool> realtime{true};
+  };
+
+  std::array<Slot, kCapacity> slots_;
+  std::atomic<uint64_t> sequence_{0};
+};
+
+/*
+ * A reader's copy of one sample, so its fields come from a single consistent read and can be
+ * handed out one at a time without allocating. Not thread safe; each reading thread keeps its own.
+ */
+class TrueSheetPositionCursor final {
+ public:
+  /*
+   * Loads the newest sample of `channel`. Returns its sequence, 0 before the first write.
+   */
+  uint64_t seekLatest(const TrueSheetPositionChannel &channel) noexcept;
+
+  /*
+   * Loads the sample with the given sequence. Returns false, keeping the loaded sample, when it
+   * has not been written yet or was already overwritten.
+   */
+  bool seek(const TrueSheetPositionChannel &channel, uint64_t sequence) noexcept;
+
+  /*
+   * Whether the loaded sample came from `channel`.
+   */
+  bool isAt(const TrueSheetPositionChannel &channel) const noexcept;
+
+  /*
+   * Sequence of the loaded sample, 0 when none is loaded.
+   */
+  uint64_t getSequence() const noexcept;
+
+  const TrueSheetPositionSample &getSample() const noexcept;
+
+ private:
+  const TrueSheetPositionChannel *channel_{nullptr};
+  TrueSheetPositionSample sample_;
+  uint64_t sequence_{0};
+};
+
+/*
+ * Channels by sheet view tag. Sheets register their channel while mounted;
+ * JS looks it up once and keeps a reference, so the lock is never on the sample path.
+ */
+class TrueSheetPositionChannelRegistry final {
+ public:
+  static void registerChannel(int tag, std::shared_ptr<TrueSheetPositionChannel> channel);
+  static void unregisterChannel(int tag);
+  static std::shared_ptr<TrueSheetPositionChannel> getChannel(int tag);
+};
+
+} // namespace facebook::react
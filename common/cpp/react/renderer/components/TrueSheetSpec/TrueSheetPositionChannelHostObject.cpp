@@ -0,0 +1,184 @@
+#include "TrueSheetPositionChannelHostObject.h"
+
+#include <cstdint>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr const char *kInstallName = "__TrueSheetPositionChannel";
+constexpr const char *kMethodsName = "__TrueSheetPositionChannelMethods";
+
+/*
+ * Sample the field getters read from. Runtimes read on their own thread, so a thread's getters
+ * see the snapshot its last `sequence` read or `seek()` loaded.
+ */
+thread_local TrueSheetPositionCursor cursor;
+
+jsi::Value sampleToValue(jsi::Runtime &runtime, const TrueSheetPositionSample &sample, uint64_t sequence) {
+  jsi::Object object(runtime);
+  object.setProperty(runtime, "index", sample.index);
+  object.setProperty(runtime, "position", sample.position);
+  object.setProperty(runtime, "detent", sample.detent);
+  object.setProperty(runtime, "timestamp", sample.timestamp);
+  object.setProperty(runtime, "realtime", sample.realtime);
+  object.setProperty(runtime, "sequence", static_cast<double>(sequence));
+  return object;
+}
+
+std::shared_ptr<TrueSheetPositionChannel> channelOf(jsi::Runtime &runtime, const jsi::Value &thisValue) {
+  if (!thisValue.isObject()) {
+    return nullptr;
+  }
+
+  auto object = thisValue.asObject(runtime);
+  if (!object.isHostObject<TrueSheetPositionChannelHostObject>(runtime)) {
+    return nullptr;
+  }
+  return object.getHostObject<TrueSheetPositionChannelHostObject>(runtime)->getChannel();
+}
+
+jsi::Object createMethods(jsi::Runtime &runtime) {
+  jsi::Object methods(runtime);
+
+  methods.setProperty(
+      runtime,
+      "latest",
+      jsi::Function::createFromHostFunction(
+          runtime,
+          jsi::PropNameID::forAscii(runtime, "latest"),
+          0,
+          [](jsi::Runtime &rt, const jsi::Value &thisValue, const jsi::Value *, size_t) -> jsi::Value {
+            auto channel = channelOf(rt, thisValue);
+            TrueSheetPositionSample sample;
+            uint64_t sequence = 0;
+            if (!channel || !channel->readLatest(sample, sequence)) {
+              return jsi::Value::null();
+            }
+            return sampleToValue(rt, sample, sequence);
+          }));
+
+  methods.setProperty(
+      runtime,
+      "read",
+      jsi::Function::createFromHostFunction(
+          runtime,
+          jsi::PropNameID::forAscii(runtime, "read"),
+          1,
+          [](jsi::Runtime &rt, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
+            auto channel = channelOf(rt, thisValue);
+            if (!channel || count < 1 || !args[0].isNumber() || args[0].asNumber() < 1) {
+              return jsi::Value::null();
+            }
+
+            auto sequence = static_cast<uint64_t>(args[0].asNumber());
+            TrueSheetPositionSample sample;
+            if (!channel->read(sequence, sample)) {
+              return jsi::Value::null();
+            }
+            return sampleToValue(rt, sample, sequence);
+          }));
+
+  methods.setProperty(
+      runtime,
+      "seek",
+      jsi::Function::createFromHostFunction(
+          runtime,
+          jsi::PropNameID::forAscii(runtime, "seek"),
+          1,
+          [](jsi::Runtime &rt, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
+            auto channel = channelOf(rt, thisValue);
+            if (!channel || count < 1 || !args[0].isNumber() || args[0].asNumber() < 1) {
+              return false;
+            }
+            return cursor.seek(*channel, static_cast<uint64_t>(args[0].asNumber()));
+          }));
+
+  return methods;
+}
+
+/*
+ * The channel methods, created once per runtime and kept on its global object, so reading
+ * `channel.latest` returns the same function every time instead of creating one.
+ */
+jsi::Value getMethod(jsi::Runtime &runtime, const char *name) {
+  auto global = runtime.global();
+  auto methods = global.getProperty(runtime, kMethodsName);
+  if (!methods.isObject()) {
+    methods = createMethods(runtime);
+    global.setProperty(runtime, kMethodsName, methods);
+  }
+  return methods.asObject(runtime).getProperty(runtime, name);
+}
+
+} // namespace
+
+TrueSheetPositionChannelHostObject::TrueSheetPositionChannelHostObject(
+    std::shared_ptr<TrueSheetPositionChannel> channel)
+    : channel_(std::move(channel)) {}
+
+const std::shared_ptr<TrueSheetPositionChannel> &TrueSheetPositionChannelHostObject::getChannel() const {
+  return channel_;
+}
+
+jsi::Value TrueSheetPositionChannelHostObject::get(jsi::Runtime &runtime, const jsi::PropNameID &name) {
+  auto propName = name.utf8(runtime);
+
+  if (propName == "sequence") {
+    return static_cast<double>(cursor.seekLatest(*channel_));
+  }
+
+  if (propName == "index" || propName == "position" || propName == "detent" || propName == "timestamp" ||
+      propName == "realtime") {
+    if (!cursor.isAt(*channel_)) {
+      cursor.seekLatest(*channel_);
+    }
+
+    const auto &sample = cursor.getSample();
+    if (propName == "index") {
+      return sample.index;
+    }
+    if (propName == "position") {
+      return sample.position;
+    }
+    if (propName == "detent") {
+      return sample.detent;
+    }
+    if (propName == "timestamp") {
+      return sample.timestamp;
+    }
+    return sample.realtime;
+  }
+
+  if (propName == "latest" || propName == "read" || propName == "seek") {
+    return getMethod(runtime, propName.c_str());
+  }
+
+  return jsi::Value::undefined();
+}
+
+std::vector<jsi::PropNameID> TrueSheetPositionChannelHostObject::getPropertyNames(jsi::Runtime &runtime) {
+  return jsi::PropNameID::names(
+      runtime, "sequence", "index", "position", "detent", "timestamp", "realtime", "latest", "read", "seek");
+}
+
+void TrueSheetPositionChannelHostObject::install(jsi::Runtime &runtime) {
+  auto name = jsi::PropNameID::forAscii(runtime, kInstallName);
+  auto getChannel = jsi::Function::createFromHostFunction(
+      runtime, name, 1, [](jsi::Runtime &rt, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
+        if (count < 1 || !args[0].isNumber()) {
+          return jsi::Value::null();
+        }
+
+        auto channel = TrueSheetPositionChannelRegistry::getChannel(static_cast<int>(args[0].asNumber()));
+        if (!channel) {
+          return jsi::Value::null();
+        }
+        return jsi::Object::createFromHostObject(
+            rt, std::make_shared<TrueSheetPositionChannelHostObject>(std::move(channel)));
+      });
+
+  runtime.global().setProperty(runtime, kInstallName, std::move(getChannel));
+}
+
+} // namespace facebook::react
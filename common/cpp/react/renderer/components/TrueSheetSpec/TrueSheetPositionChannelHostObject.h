@@ -0,0 +1,40 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <memory>
+#include <vector>
+
+#include "TrueSheetPositionChannel.h"
+
+namespace facebook::react {
+
+/*
+ * Read-only JS view of a sheet's position channel. Reads are lock-free, so the object can be
+ * captured by worklets and polled from the UI runtime.
+ *
+ * Reading `sequence` snapshots the newest sample, and `index`, `position`, `detent`,
+ * `timestamp` and `realtime` return the snapshot's fields as plain values, so polling every
+ * frame allocates nothing. `seek(sequence)` snapshots an older sample instead. `latest()` and
+ * `read(sequence)` return the sample as an object; those functions are created once per runtime.
+ */
+class TrueSheetPositionChannelHostObject final : public jsi::HostObject {
+ public:
+  explicit TrueSheetPositionChannelHostObject(std::shared_ptr<TrueSheetPositionChannel> channel);
+
+  jsi::Value get(jsi::Runtime &runtime, const jsi::PropNameID &name) override;
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime &runtime) override;
+
+  /*
+   * Installs `global.__TrueSheetPositionChannel(viewTag)`, which returns the channel
+   * host object for a mounted sheet or `null`.
+   */
+  static void install(jsi::Runtime &runtime);
+
+  const std::shared_ptr<TrueSheetPositionChannel> &getChannel() const;
+
+ private:
+  std::shared_ptr<TrueSheetPositionChannel> channel_;
+};
+
+} // namespace facebook::react
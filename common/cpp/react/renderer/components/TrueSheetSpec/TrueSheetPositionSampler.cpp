@@ -0,0 +1,49 @@
+#include "TrueSheetPositionSampler.h"
+
+#include <cmath>
+
+namespace facebook::react {
+
+void TrueSheetPositionSampler::setPolicy(const TrueSheetPositionPolicy &policy) noexcept {
+  if (policy_ == policy) {
+    return;
+  }
+  policy_ = policy;
+  reset();
+}
+
+const TrueSheetPositionPolicy &TrueSheetPositionSampler::getPolicy() const noexcept {
+  return policy_;
+}
+
+bool TrueSheetPositionSampler::isUnrestricted() const noexcept {
+  return !policy_.settledOnly && policy_.maxHz <= 0 && policy_.minDelta <= 0;
+}
+
+bool TrueSheetPositionSampler::shouldEmit(double position, bool realtime, double timestamp) noexcept {
+  if (realtime) {
+    if (policy_.settledOnly) {
+      return false;
+    }
+    // Half a millisecond of slack so frames arriving marginally early still meet a `maxHz` limit
+    if (hasEmitted_ && policy_.maxHz > 0 && timestamp - lastTimestamp_ < 1000.0 / policy_.maxHz - 0.5) {
+      return false;
+    }
+    if (hasEmitted_ && policy_.minDelta > 0 && std::abs(position - lastPosition_) < policy_.minDelta) {
+      return false;
+    }
+  }
+
+  hasEmitted_ = true;
+  lastPosition_ = position;
+  lastTimestamp_ = timestamp;
+  return true;
+}
+
+void TrueSheetPositionSampler::reset() noexcept {
+  hasEmitted_ = false;
+  lastPosition_ = 0;
+  lastTimestamp_ = 0;
+}
+
+} // namespace facebook::react
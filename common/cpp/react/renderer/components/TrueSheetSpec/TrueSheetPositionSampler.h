@@ -0,0 +1,54 @@
+#pragma once
+
+namespace facebook::react {
+
+/*
+ * How often realtime position changes reach JS. Settle (non-realtime) positions are always
+ * emitted. Positions share the event unit — points on iOS, dp on Android.
+ */
+struct TrueSheetPositionPolicy {
+  // Drop every realtime sample
+  bool settledOnly{false};
+  // Upper bound for realtime samples per second. Ignored when <= 0.
+  double maxHz{0};
+  // Minimum distance from the last emitted position. Ignored when <= 0.
+  double minDelta{0};
+
+  bool operator==(const TrueSheetPositionPolicy &other) const = default;
+};
+
+/*
+ * Applies a `TrueSheetPositionPolicy` to a sheet's position samples before any event is built.
+ */
+class TrueSheetPositionSampler final {
+ public:
+  /*
+   * Replaces the policy. Changing it forgets the last emitted sample.
+   */
+  void setPolicy(const TrueSheetPositionPolicy &policy) noexcept;
+  const TrueSheetPositionPolicy &getPolicy() const noexcept;
+
+  /*
+   * True when every sample passes, so callers can skip `shouldEmit`.
+   */
+  bool isUnrestricted() const noexcept;
+
+  /*
+   * Whether a sample should be emitted. Accepted samples become the reference for
+   * the next `maxHz` and `minDelta` checks. `timestamp` is in milliseconds.
+   */
+  bool shouldEmit(double position, bool realtime, double timestamp) noexcept;
+
+  /*
+   * Forgets the last emitted sample, e.g. when the sheet is dismissed.
+   */
+  void reset() noexcept;
+
+ private:
+  TrueSheetPositionPolicy policy_;
+  bool hasEmitted_{false};
+  double lastPosition_{0};
+  double lastTimestamp_{0};
+};
+
+} // namespace facebook::react
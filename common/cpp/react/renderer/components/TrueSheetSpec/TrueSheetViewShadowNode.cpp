@@ -11,38 +11,37 @@ extern const char TrueSheetViewComponentName[] = "TrueSheetView";
 void TrueSheetViewShadowNode::adjustLayoutWithState() {
   ensureUnsealed();
 
-  auto state = std::static_pointer_cast<
-      const TrueSheetViewShadowNode::ConcreteState>(getState());
-  auto stateData = state->getData();
+  auto &stateData = getStateData();
+  bool hasWidth = stateData.containerWidth > 0;
+  bool hasHeight = stateData.containerHeight > 0;
 
   // If container dimensions are set from native, override Yoga's dimensions
-  if (stateData.containerWidth > 0 || stateData.containerHeight > 0) {
-    auto &props = getConcreteProps();
-    yoga::Style adjustedStyle = props.yogaStyle;
-    auto currentStyle = yogaNode_.style();
-    bool needsUpdate = false;
-
-    // Set width if provided
-    if (stateData.containerWidth > 0) {
-      adjustedStyle.setDimension(yoga::Dimension::Width, StyleSizeLength::points(stateData.containerWidth));
-      if (adjustedStyle.dimension(yoga::Dimension::Width) != currentStyle.dimension(yoga::Dimension::Width)) {
-        needsUpdate = true;
-      }
-    }
-
-    // Set height if provided
-    if (stateData.containerHeight > 0) {
-      adjustedStyle.setDimension(yoga::Dimension::Height, StyleSizeLength::points(stateData.containerHeight));
-      if (adjustedStyle.dimension(yoga::Dimension::Height) != currentStyle.dimension(yoga::Dimension::Height)) {
-        needsUpdate = true;
-      }
-    }
-
-    if (needsUpdate) {
-      yogaNode_.setStyle(adjustedStyle);
-      yogaNode_.setDirty(true);
-    }
+  if (!hasWidth && !hasHeight) {
+    return;
   }
+
+  // The yoga node already holds the last applied size (clones inherit it), so
+  // compare against it before copying the style
+  auto width = StyleSizeLength::points(stateData.containerWidth);
+  auto height = StyleSizeLength::points(stateData.containerHeight);
+  const auto &currentStyle = yogaNode_.style();
+  bool widthChanged = hasWidth && currentStyle.dimension(yoga::Dimension::Width) != width;
+  bool heightChanged = hasHeight && currentStyle.dimension(yoga::Dimension::Height) != height;
+
+  if (!widthChanged && !heightChanged) {
+    return;
+  }
+
+  yoga::Style adjustedStyle = getConcreteProps().yogaStyle;
+  if (hasWidth) {
+    adjustedStyle.setDimension(yoga::Dimension::Width, width);
+  }
+  if (hasHeight) {
+    adjustedStyle.setDimension(yoga::Dimension::Height, height);
+  }
+
+  yogaNode_.setStyle(adjustedStyle);
+  yogaNode_.setDirty(true);
 }
 
 #if !defined(ANDROID)
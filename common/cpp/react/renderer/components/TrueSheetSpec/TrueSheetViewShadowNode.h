@@ -20,7 +20,8 @@ class JSI_EXPORT TrueSheetViewShadowNode final
           TrueSheetViewComponentName,
           TrueSheetViewProps,
           TrueSheetViewEventEmitter,
-          TrueSheetViewState> {
+          TrueSheetViewState,
+          /* usesMapBufferForStateData */ true> {
   using ConcreteViewShadowNode::ConcreteViewShadowNode;
 
  public:
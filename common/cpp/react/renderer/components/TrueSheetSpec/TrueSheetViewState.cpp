@@ -6,6 +6,13 @@ namespace facebook::react {
 folly::dynamic TrueSheetViewState::getDynamic() const {
   return folly::dynamic::object("containerWidth", containerWidth)("containerHeight", containerHeight);
 }
+
+MapBuffer TrueSheetViewState::getMapBuffer() const {
+  auto builder = MapBufferBuilder();
+  builder.putDouble(kContainerWidthKey, containerWidth);
+  builder.putDouble(kContainerHeightKey, containerHeight);
+  return builder.build();
+}
 #endif
 
 #if !defined(ANDROID)
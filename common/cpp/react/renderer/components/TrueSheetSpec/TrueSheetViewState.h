@@ -22,6 +22,9 @@ class TrueSheetViewState final {
 
   TrueSheetViewState() = default;
 
+  TrueSheetViewState(float containerWidth, float containerHeight)
+      : containerWidth(containerWidth), containerHeight(containerHeight) {}
+
 #ifdef ANDROID
   TrueSheetViewState(
       TrueSheetViewState const &previousState,
@@ -34,10 +37,13 @@ class TrueSheetViewState final {
   float containerHeight{0};
 
 #ifdef ANDROID
+  // Typed MapBuffer keys read from Kotlin through `StateWrapper.stateDataMapBuffer`.
+  // Keep in sync with `TrueSheetViewState.kt`.
+  static constexpr MapBuffer::Key kContainerWidthKey = 0;
+  static constexpr MapBuffer::Key kContainerHeightKey = 1;
+
   folly::dynamic getDynamic() const;
-  MapBuffer getMapBuffer() const {
-    return MapBufferBuilder::EMPTY();
-  }
+  MapBuffer getMapBuffer() const;
 #endif
 
 #if !defined(ANDROID)
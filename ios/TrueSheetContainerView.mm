@@ -23,6 +23,7 @@
 #import <react/renderer/components/TrueSheetSpec/EventEmitters.h>
 #import <react/renderer/components/TrueSheetSpec/Props.h>
 #import <react/renderer/components/TrueSheetSpec/RCTComponentViewHelpers.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetLayoutRegistry.h>
 
 #import <React/RCTConversions.h>
 #import <React/RCTLog.h>
@@ -114,16 +115,26 @@ using namespace facebook::react;
   [_contentView updateScrollViewHeight];
 }
 
+// Prefer the height published by the shadow node during commit; the frame lags until mount
+static CGFloat measuredHeight(UIView *view) {
+  if (!view) {
+    return 0;
+  }
+
+  double height = TrueSheetLayoutRegistry::getHeight((Tag)view.tag);
+  return height != TrueSheetLayoutRegistry::kUnknownHeight ? height : view.frame.size.height;
+}
+
 - (CGFloat)contentHeight {
-  return _contentView ? _contentView.frame.size.height : 0;
+  return measuredHeight(_contentView);
 }
 
 - (CGFloat)headerHeight {
-  return _headerView ? _headerView.frame.size.height : 0;
+  return measuredHeight(_headerView);
 }
 
 - (CGFloat)footerHeight {
-  return _footerView ? _footerView.frame.size.height : 0;
+  return measuredHeight(_footerView);
 }
 
 // Distance from the top of the content view to the bottom of the peek view.
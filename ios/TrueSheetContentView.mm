@@ -14,6 +14,7 @@
 #import <react/renderer/components/TrueSheetSpec/EventEmitters.h>
 #import <react/renderer/components/TrueSheetSpec/Props.h>
 #import <react/renderer/components/TrueSheetSpec/RCTComponentViewHelpers.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetMeasuredViewComponentDescriptors.h>
 #import "TrueSheetContainerView.h"
 #import "TrueSheetView.h"
 #import "TrueSheetViewController.h"
@@ -369,6 +370,7 @@ using namespace facebook::react;
 
 - (void)prepareForRecycle {
   [super prepareForRecycle];
+  TrueSheetLayoutRegistry::remove((Tag)self.tag);
   [self stopObservingTextChanges];
   [self clearScrollable];
 }
@@ -13,6 +13,7 @@
 #import <react/renderer/components/TrueSheetSpec/EventEmitters.h>
 #import <react/renderer/components/TrueSheetSpec/Props.h>
 #import <react/renderer/components/TrueSheetSpec/RCTComponentViewHelpers.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetMeasuredViewComponentDescriptors.h>
 #import "TrueSheetViewController.h"
 #import "utils/LayoutUtil.h"
 #import "utils/UIView+ScrollEdgeInteraction.h"
@@ -131,6 +132,7 @@ using namespace facebook::react;
 
 - (void)prepareForRecycle {
   [super prepareForRecycle];
+  TrueSheetLayoutRegistry::remove((Tag)self.tag);
 
   [LayoutUtil unpinView:self fromParentView:self.superview];
   if (@available(iOS 26.0, *)) {
@@ -12,16 +12,22 @@
 #ifdef RCT_NEW_ARCH_ENABLED
 
 #import "TrueSheetModule.h"
+#import <React/RCTFollyConvert.h>
 #import <React/RCTUtils.h>
 #import "TrueSheetView.h"
 #import "TrueSheetViewController.h"
 
+#import <ReactCommon/RCTTurboModuleWithJSIBindings.h>
 #import <TrueSheetSpec/TrueSheetSpec.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetCommandQueue.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetCommandQueueHostObject.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetMetrics.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetPositionChannelHostObject.h>
 
 // Static registry to store view references by tag
 static NSMutableDictionary<NSNumber *, TrueSheetView *> *viewRegistry;
 
-@interface TrueSheetModule () <NativeTrueSheetModuleSpec>
+@interface TrueSheetModule () <NativeTrueSheetModuleSpec, RCTTurboModuleWithJSIBindings>
 @end
 
 @implementation TrueSheetModule
@@ -43,6 +49,72 @@ RCT_EXPORT_MODULE(TrueSheetModule)
   return std::make_shared<facebook::react::NativeTrueSheetModuleSpecJSI>(params);
 }
 
+- (void)installJSIBindingsWithRuntime:(facebook::jsi::Runtime &)runtime
+                          callInvoker:(const std::shared_ptr<facebook::react::CallInvoker> &)callInvoker {
+  facebook::react::TrueSheetPositionChannelHostObject::install(runtime);
+  facebook::react::TrueSheetCommandQueueHostObject::install(runtime, callInvoker);
+
+  // Commands queued until the main queue gets to the drain join the same batch
+  facebook::react::TrueSheetCommandQueue::setScheduler([]() {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [TrueSheetModule runCommands];
+    });
+  });
+}
+
+#pragma mark - Command Queue
+
++ (void)runCommands {
+  auto isPresented = [](int32_t tag) {
+    return [TrueSheetModule getTrueSheetViewByTag:@(tag)].viewController.isPresented;
+  };
+
+  for (const auto &command : facebook::react::TrueSheetCommandQueue::drain(isPresented)) {
+    [self runCommand:command];
+  }
+}
+
+/**
+ * Runs a queued command. Completion is reported with the sheet's `onCommandComplete` event
+ * instead of a promise, or through the command queue when the sheet is no longer registered.
+ */
++ (void)runCommand:(const facebook::react::TrueSheetCommand &)command {
+  using facebook::react::TrueSheetCommandType;
+
+  TrueSheetView *trueSheetView = [TrueSheetModule getTrueSheetViewByTag:@(command.tag)];
+  if (!trueSheetView) {
+    facebook::react::TrueSheetCommandQueue::fail(command, "No sheet found with tag " + std::to_string(command.tag));
+    return;
+  }
+
+  if (command.superseded) {
+    [trueSheetView emitCommandCompleteWithId:command.id error:nil superseded:YES];
+    return;
+  }
+
+  NSInteger commandId = command.id;
+  __weak TrueSheetView *weakView = trueSheetView;
+  TrueSheetCompletionBlock completion = ^(BOOL success, NSError *_Nullable error) {
+    NSString *message = success ? nil : (error.localizedDescription ?: @"Command failed");
+    [weakView emitCommandCompleteWithId:commandId error:message superseded:NO];
+  };
+
+  switch (command.type) {
+    case TrueSheetCommandType::Present:
+      [trueSheetView presentAtIndex:command.index animated:command.animated completion:completion];
+      break;
+    case TrueSheetCommandType::Resize:
+      [trueSheetView resizeToIndex:command.index completion:completion];
+      break;
+    case TrueSheetCommandType::Dismiss:
+      [trueSheetView dismissAnimated:command.animated completion:completion];
+      break;
+    case TrueSheetCommandType::DismissStack:
+      [trueSheetView dismissStackAnimated:command.animated completion:completion];
+      break;
+  }
+}
+
 #pragma mark - TurboModule Methods
 
 - (void)presentByRef:(double)viewTag
@@ -183,6 +255,14 @@ RCT_EXPORT_MODULE(TrueSheetModule)
   });
 }
 
+- (NSDictionary *)getMetrics {
+  return facebook::react::convertFollyDynamicToId(facebook::react::TrueSheetMetrics::shared().snapshot().getDynamic());
+}
+
+- (void)resetMetrics {
+  facebook::react::TrueSheetMetrics::shared().reset();
+}
+
 #pragma mark - Helper Methods
 
 + (nullable TrueSheetView *)getTrueSheetViewByTag:(NSNumber *)reactTag {
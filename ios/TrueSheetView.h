@@ -38,6 +38,9 @@ typedef void (^TrueSheetCompletionBlock)(BOOL success, NSError *_Nullable error)
 
 - (void)dismissStackAnimated:(BOOL)animated completion:(nullable TrueSheetCompletionBlock)completion;
 
+// Reports a finished command from the JSI command queue
+- (void)emitCommandCompleteWithId:(NSInteger)commandId error:(nullable NSString *)error superseded:(BOOL)superseded;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -15,6 +15,7 @@
 #import "TrueSheetModule.h"
 #import "TrueSheetViewController.h"
 #import "core/RNScreensEventObserver.h"
+#import "events/TrueSheetCommandEvents.h"
 #import "events/TrueSheetDragEvents.h"
 #import "events/TrueSheetFocusEvents.h"
 #import "events/TrueSheetLifecycleEvents.h"
@@ -23,7 +24,10 @@
 
 #import <react/renderer/components/TrueSheetSpec/EventEmitters.h>
 #import <react/renderer/components/TrueSheetSpec/Props.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetMetrics.h>
 #import <react/renderer/components/TrueSheetSpec/RCTComponentViewHelpers.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetPositionChannel.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetPositionSampler.h>
 #import <react/renderer/components/TrueSheetSpec/TrueSheetViewComponentDescriptor.h>
 #import <react/renderer/components/TrueSheetSpec/TrueSheetViewShadowNode.h>
 #import <react/renderer/components/TrueSheetSpec/TrueSheetViewState.h>
@@ -38,6 +42,78 @@
 
 using namespace facebook::react;
 
+/**
+ * Reconfiguration stages of a presented sheet. Prop updates mark the stages they affect,
+ * and each transaction runs only those.
+ */
+typedef NS_OPTIONS(NSUInteger, TrueSheetPropStage) {
+  TrueSheetPropStageScrollable = 1 << 0,
+  TrueSheetPropStageAnchor = 1 << 1,
+  TrueSheetPropStageSizing = 1 << 2,
+  TrueSheetPropStageAppearance = 1 << 3,
+  TrueSheetPropStageDetents = 1 << 4,
+  TrueSheetPropStageDraggable = 1 << 5,
+  TrueSheetPropStageAll = (1 << 6) - 1,
+};
+
+static BOOL grabberOptionsEqual(const TrueSheetViewGrabberOptionsStruct &a, const TrueSheetViewGrabberOptionsStruct &b) {
+  return a.width == b.width && a.height == b.height && a.topMargin == b.topMargin && a.cornerRadius == b.cornerRadius &&
+         a.color == b.color && a.adaptive == b.adaptive;
+}
+
+static BOOL accessibilityOptionsEqual(const TrueSheetViewAccessibilityOptionsStruct &a,
+                                      const TrueSheetViewAccessibilityOptionsStruct &b) {
+  return a.grabberLabel == b.grabberLabel && a.grabberHint == b.grabberHint && a.expandedValue == b.expandedValue &&
+         a.collapsedValue == b.collapsedValue && a.detentValue == b.detentValue &&
+         a.expandActionLabel == b.expandActionLabel && a.collapseActionLabel == b.collapseActionLabel &&
+         a.paneTitle == b.paneTitle;
+}
+
+static BOOL scrollableOptionsEqual(const TrueSheetViewScrollableOptionsStruct &a,
+                                   const TrueSheetViewScrollableOptionsStruct &b) {
+  return a.keyboardScrollOffset == b.keyboardScrollOffset && a.scrollingExpandsSheet == b.scrollingExpandsSheet &&
+         a.topScrollEdgeEffect == b.topScrollEdgeEffect && a.bottomScrollEdgeEffect == b.bottomScrollEdgeEffect;
+}
+
+static TrueSheetPropStage dirtyStagesForProps(const TrueSheetViewProps &newProps, const TrueSheetViewProps &oldProps) {
+  TrueSheetPropStage stages = 0;
+
+  if (newProps.scrollable != oldProps.scrollable ||
+      !scrollableOptionsEqual(newProps.scrollableOptions, oldProps.scrollableOptions)) {
+    // `scrollingExpandsSheet` is applied with the appearance
+    stages |= TrueSheetPropStageScrollable | TrueSheetPropStageAppearance;
+  }
+  if (newProps.insetAdjustment != oldProps.insetAdjustment) {
+    stages |= TrueSheetPropStageScrollable | TrueSheetPropStageDetents;
+  }
+  if (newProps.anchor != oldProps.anchor || newProps.anchorOffset != oldProps.anchorOffset) {
+    stages |= TrueSheetPropStageAnchor;
+  }
+  if (newProps.presentation != oldProps.presentation || newProps.maxContentWidth != oldProps.maxContentWidth) {
+    stages |= TrueSheetPropStageSizing;
+  }
+  if (newProps.maxContentHeight != oldProps.maxContentHeight) {
+    stages |= TrueSheetPropStageSizing | TrueSheetPropStageDetents;
+  }
+  if (newProps.backgroundColor != oldProps.backgroundColor || newProps.backgroundBlur != oldProps.backgroundBlur ||
+      newProps.blurOptions.intensity != oldProps.blurOptions.intensity ||
+      newProps.blurOptions.interaction != oldProps.blurOptions.interaction ||
+      newProps.cornerRadius != oldProps.cornerRadius || newProps.grabber != oldProps.grabber ||
+      !grabberOptionsEqual(newProps.grabberOptions, oldProps.grabberOptions) ||
+      !accessibilityOptionsEqual(newProps.accessibilityOptions, oldProps.accessibilityOptions)) {
+    stages |= TrueSheetPropStageAppearance;
+  }
+  if (newProps.draggable != oldProps.draggable) {
+    stages |= TrueSheetPropStageAppearance | TrueSheetPropStageDraggable;
+  }
+  if (newProps.detents != oldProps.detents || newProps.dimmed != oldProps.dimmed ||
+      newProps.dimmedDetentIndex != oldProps.dimmedDetentIndex) {
+    stages |= TrueSheetPropStageDetents;
+  }
+
+  return stages;
+}
+
 @interface TrueSheetView () <TrueSheetViewControllerDelegate,
   TrueSheetContainerViewDelegate,
   RNScreensEventObserverDelegate>
@@ -55,6 +131,10 @@ using namespace facebook::react;
   BOOL _scrollable;
   ScrollableOptions *_scrollableOptions;
   BOOL _initialDetentAnimated;
+  NSInteger _presentRequestIndex;
+  BOOL _presentRequestAnimated;
+  NSInteger _presentRequestId;
+  NSInteger _handledPresentRequestId;
   BOOL _isSheetUpdatePending;
   BOOL _pendingLayoutUpdate;
   BOOL _didInitiallyPresent;
@@ -63,8 +143,16 @@ using namespace facebook::react;
   BOOL _pendingMountEvent;
   BOOL _pendingSizeChange;
   BOOL _pendingPropsUpdate;
+  TrueSheetPropStage _dirtyStages;
   NSArray *_pendingDetents;
   RNScreensEventObserver *_screensEventObserver;
+  NSInteger _positionSequence;
+  NSInteger _dragSequence;
+  std::shared_ptr<TrueSheetPositionChannel> _positionChannel;
+  // Applies positionChangePolicy to onPositionChange only; the position channel gets every sample
+  TrueSheetPositionSampler _positionSampler;
+  CFTimeInterval _presentStartTime;
+  CFTimeInterval _dismissStartTime;
 }
 
 #pragma mark - Initialization
@@ -86,11 +174,15 @@ using namespace facebook::react;
     _lastStateSize = CGSizeZero;
     _initialDetentIndex = -1;
     _initialDetentAnimated = YES;
+    _presentRequestIndex = -1;
+    _presentRequestAnimated = YES;
     _scrollable = NO;
     _isSheetUpdatePending = NO;
 
     _screensEventObserver = [[RNScreensEventObserver alloc] init];
     _screensEventObserver.delegate = self;
+
+    _positionChannel = std::make_shared<TrueSheetPositionChannel>();
   }
   return self;
 }
@@ -103,6 +195,7 @@ using namespace facebook::react;
 
   if (self.tag > 0) {
     [TrueSheetModule registerView:self withTag:@(self.tag)];
+    TrueSheetPositionChannelRegistry::registerChannel((int)self.tag, _positionChannel);
   }
 
   if (_pendingNavigationRepresent && !_controller.isPresented) {
@@ -111,6 +204,8 @@ using namespace facebook::react;
     return;
   }
 
+  [self presentRequestedSheetIfNeeded];
+
   if (_initialDetentIndex >= 0 && !_didInitiallyPresent) {
     UIViewController *vc = [self findPresentingViewController];
 
@@ -149,6 +244,7 @@ using namespace facebook::react;
   _snapshotView = nil;
 
   [TrueSheetModule unregisterViewWithTag:@(self.tag)];
+  TrueSheetPositionChannelRegistry::unregisterChannel((int)self.tag);
 }
 
 #pragma mark - RCTComponentViewProtocol
@@ -173,6 +269,9 @@ using namespace facebook::react;
     if (newProps.detents != prevProps.detents || newProps.insetAdjustment != prevProps.insetAdjustment) {
       _pendingLayoutUpdate = YES;
     }
+    _dirtyStages |= dirtyStagesForProps(newProps, prevProps);
+  } else {
+    _dirtyStages = TrueSheetPropStageAll;
   }
 
   if (_controller.isBeingPresented) {
@@ -244,6 +343,10 @@ using namespace facebook::react;
 
   _initialDetentIndex = newProps.initialDetentIndex;
   _initialDetentAnimated = newProps.initialDetentAnimated;
+
+  _presentRequestIndex = newProps.presentRequest.index;
+  _presentRequestAnimated = newProps.presentRequest.animated;
+  _presentRequestId = newProps.presentRequest.id;
   _scrollable = newProps.scrollable;
 
   const auto &scrollableOpts = newProps.scrollableOptions;
@@ -276,7 +379,12 @@ using namespace facebook::react;
   _insetAdjustment = newProps.insetAdjustment;
   _controller.insetAdjustment = _insetAdjustment;
 
-  [self setupScrollable];
+  const auto &positionPolicyProps = newProps.positionChangePolicy;
+  TrueSheetPositionPolicy positionPolicy;
+  positionPolicy.settledOnly = positionPolicyProps.settledOnly;
+  positionPolicy.maxHz = positionPolicyProps.maxHz;
+  positionPolicy.minDelta = positionPolicyProps.minDelta;
+  _positionSampler.setPolicy(positionPolicy);
 }
 
 - (void)updateState:(const State::Shared &)state oldState:(const State::Shared &)oldState {
@@ -299,6 +407,7 @@ using namespace facebook::react;
     return;
 
   _lastStateSize = size;
+  TrueSheetMetrics::shared().recordStateUpdate();
 
   auto stateData = _state->getData();
   stateData.containerWidth = static_cast<float>(size.width);
@@ -322,17 +431,28 @@ using namespace facebook::react;
     [TrueSheetLifecycleEvents emitMount:_eventEmitter];
   }
 
-  if (!(updateMask & RNComponentViewUpdateMaskProps) || !_controller)
-    return;
+  if ((updateMask & RNComponentViewUpdateMaskProps) && _controller && _dirtyStages != 0) {
+    [self finalizePropStages];
+  }
 
-  [self setupScrollable];
+  [self presentRequestedSheetIfNeeded];
+}
+
+- (void)finalizePropStages {
+  if (_dirtyStages & TrueSheetPropStageScrollable) {
+    [self setupScrollable];
+  }
 
   if (_controller.isPresented) {
     [self applySheetPropsUpdate];
   } else if (_controller.isBeingPresented) {
     _pendingPropsUpdate = YES;
-  } else if (_initialDetentIndex >= 0) {
-    _pendingLayoutUpdate = NO;
+  } else {
+    // Presenting applies every stage
+    _dirtyStages = 0;
+    if (_initialDetentIndex >= 0) {
+      _pendingLayoutUpdate = NO;
+    }
   }
 }
 
@@ -340,11 +460,16 @@ using namespace facebook::react;
   [super prepareForRecycle];
 
   [TrueSheetModule unregisterViewWithTag:@(self.tag)];
+  TrueSheetPositionChannelRegistry::unregisterChannel((int)self.tag);
 
   _lastStateSize = CGSizeZero;
   _didInitiallyPresent = NO;
   _dismissedByNavigation = NO;
   _pendingNavigationRepresent = NO;
+  _presentStartTime = 0;
+  _dismissStartTime = 0;
+  _dirtyStages = 0;
+  _handledPresentRequestId = 0;
 }
 
 #pragma mark - Child Component Mounting
@@ -386,6 +511,47 @@ using namespace facebook::react;
   _controller.accessibilityContentView = _containerView;
   [_controller setupAccessibilityContainer];
 
+  [self syncContainerHeights];
+
+  if (_eventEmitter) {
+    [TrueSheetLifecycleEvents emitMount:_eventEmitter];
+  } else {
+    _pendingMountEvent = YES;
+  }
+  [self presentRequestedSheetIfNeeded];
+}
+
+/**
+ * Runs a present requested through the `presentRequest` prop once the container has mounted.
+ * A cold `present()` mounts the container and requests the present in the same commit, so it
+ * needs no round trip through the module. Whichever of the props update and the container
+ * mount lands last in the transaction triggers it.
+ */
+- (void)presentRequestedSheetIfNeeded {
+  if (_presentRequestIndex < 0 || _presentRequestId == _handledPresentRequestId)
+    return;
+
+  // Retried from didMoveToWindow
+  if (!_containerView || !self.window)
+    return;
+
+  // The request id is a command id, so completion is reported through `onCommandComplete`
+  NSInteger requestId = _presentRequestId;
+  _handledPresentRequestId = requestId;
+  __weak TrueSheetView *weakSelf = self;
+  [self presentAtIndex:_presentRequestIndex
+              animated:_presentRequestAnimated
+            completion:^(BOOL success, NSError *_Nullable error) {
+              NSString *message = success ? nil : (error.localizedDescription ?: @"Failed to present sheet");
+              [weakSelf emitCommandCompleteWithId:requestId error:message superseded:NO];
+            }];
+}
+
+/**
+ * Copies the container's measured heights into the controller.
+ * Heights come from the committed layout, so they are exact even before the views are mounted.
+ */
+- (void)syncContainerHeights {
   CGFloat contentHeight = [_containerView contentHeight];
   if (contentHeight > 0) {
     _controller.contentHeight = @(contentHeight);
@@ -405,12 +571,6 @@ using namespace facebook::react;
   if (peekContentHeight > 0) {
     _controller.peekContentHeight = @(peekContentHeight);
   }
-
-  if (_eventEmitter) {
-    [TrueSheetLifecycleEvents emitMount:_eventEmitter];
-  } else {
-    _pendingMountEvent = YES;
-  }
 }
 
 - (void)unmountChildComponentView:(UIView<RCTComponentViewProtocol> *)childComponentView index:(NSInteger)index {
@@ -448,6 +608,7 @@ using namespace facebook::react;
 
   // Reset navigation dismiss flag when presenting (handles view recycling edge cases)
   _dismissedByNavigation = NO;
+  _presentStartTime = CACurrentMediaTime();
 
   UIViewController *presentingViewController = [self findPresentingViewController];
   if (!presentingViewController) {
@@ -460,6 +621,8 @@ using namespace facebook::react;
     return;
   }
 
+  [self syncContainerHeights];
+
   [_controller setupAnchorViewInView:presentingViewController.view];
   [_controller setupSheetSizing];
   [_controller setupSheetProps];
@@ -502,12 +665,29 @@ using namespace facebook::react;
   return _controller;
 }
 
+- (void)writePositionSampleWithIndex:(CGFloat)index
+                            position:(CGFloat)position
+                              detent:(CGFloat)detent
+                            realtime:(BOOL)realtime
+                           timestamp:(double)timestamp {
+  _positionChannel->write({index, position, detent, timestamp, static_cast<bool>(realtime)});
+}
+
 - (void)emitDismissedPosition {
+  double timestamp = CACurrentMediaTime() * 1000;
+  [self writePositionSampleWithIndex:-1 position:_controller.screenHeight detent:0 realtime:NO timestamp:timestamp];
+  TrueSheetMetrics::shared().recordPositionEmitted();
   [TrueSheetStateEvents emitPositionChange:_eventEmitter
                                      index:-1
                                   position:_controller.screenHeight
                                     detent:0
-                                  realtime:NO];
+                                  realtime:NO
+                                  sequence:++_positionSequence
+                                 timestamp:timestamp];
+}
+
+- (void)emitCommandCompleteWithId:(NSInteger)commandId error:(nullable NSString *)error superseded:(BOOL)superseded {
+  [TrueSheetCommandEvents emitCommandComplete:_eventEmitter commandId:commandId error:error superseded:superseded];
 }
 
 - (void)dismissAnimated:(BOOL)animated completion:(nullable TrueSheetCompletionBlock)completion {
@@ -520,8 +700,11 @@ using namespace facebook::react;
     return;
   }
 
+  _dismissStartTime = CACurrentMediaTime();
+
   // Dismiss from the presenting view controller to dismiss this sheet and all its children
   UIViewController *presenter = _controller.presentingViewController;
+  [TrueSheetView markStackDismissFrom:_controller];
   [presenter dismissViewControllerAnimated:animated
                                 completion:^{
                                   if (completion) {
@@ -549,6 +732,7 @@ using namespace facebook::react;
   }
 
   // Calling dismiss on _controller dismisses all VCs presented on top of it, but keeps _controller presented
+  [TrueSheetView markStackDismissFrom:_controller.presentedViewController];
   [_controller dismissViewControllerAnimated:animated
                                   completion:^{
                                     if (completion) {
@@ -621,6 +805,11 @@ using namespace facebook::react;
   [_containerView setupKeyboardObserverWithViewController:_controller];
   [TrueSheetLifecycleEvents emitDidPresent:_eventEmitter index:index position:position detent:detent];
 
+  if (_presentStartTime > 0) {
+    TrueSheetMetrics::shared().recordPresentLatency((CACurrentMediaTime() - _presentStartTime) * 1000);
+    _presentStartTime = 0;
+  }
+
   if (_pendingPropsUpdate) {
     _pendingPropsUpdate = NO;
     [self applySheetPropsUpdate];
@@ -641,7 +830,12 @@ using namespace facebook::react;
       [TrueSheetDragEvents emitDragBegin:_eventEmitter index:index position:position detent:detent];
       break;
     case UIGestureRecognizerStateChanged:
-      [TrueSheetDragEvents emitDragChange:_eventEmitter index:index position:position detent:detent];
+      [TrueSheetDragEvents emitDragChange:_eventEmitter
+                                    index:index
+                                 position:position
+                                   detent:detent
+                                 sequence:++_dragSequence
+                                timestamp:CACurrentMediaTime() * 1000];
       break;
     case UIGestureRecognizerStateEnded:
     case UIGestureRecognizerStateCancelled:
@@ -652,7 +846,19 @@ using namespace facebook::react;
   }
 }
 
+- (void)viewControllerWillSettleAtIndex:(NSInteger)index
+                               position:(CGFloat)position
+                                 detent:(CGFloat)detent
+                               duration:(CGFloat)duration {
+  [TrueSheetDragEvents emitWillSettle:_eventEmitter index:index position:position detent:detent duration:duration];
+}
+
 - (void)viewControllerWillDismiss {
+  // Swipe and navigation dismissals start here
+  if (_dismissStartTime == 0) {
+    _dismissStartTime = CACurrentMediaTime();
+  }
+
   if (!_dismissedByNavigation) {
     [TrueSheetLifecycleEvents emitWillDismiss:_eventEmitter];
   }
@@ -660,6 +866,13 @@ using namespace facebook::react;
 
 - (void)viewControllerDidDismiss {
   [_containerView cleanupKeyboardObserver];
+  _positionSampler.reset();
+
+  if (_dismissStartTime > 0) {
+    TrueSheetMetrics::shared().recordDismissLatency((CACurrentMediaTime() - _dismissStartTime) * 1000);
+    _dismissStartTime = 0;
+  }
+
   if (!_dismissedByNavigation) {
     _dismissedByNavigation = NO;
     _pendingNavigationRepresent = NO;
@@ -680,7 +893,21 @@ using namespace facebook::react;
                                position:(CGFloat)position
                                  detent:(CGFloat)detent
                                realtime:(BOOL)realtime {
-  [TrueSheetStateEvents emitPositionChange:_eventEmitter index:index position:position detent:detent realtime:realtime];
+  double timestamp = CACurrentMediaTime() * 1000;
+  [self writePositionSampleWithIndex:index position:position detent:detent realtime:realtime timestamp:timestamp];
+
+  if (!_positionSampler.isUnrestricted() && !_positionSampler.shouldEmit(position, realtime, timestamp)) {
+    return;
+  }
+
+  TrueSheetMetrics::shared().recordPositionEmitted();
+  [TrueSheetStateEvents emitPositionChange:_eventEmitter
+                                     index:index
+                                  position:position
+                                    detent:detent
+                                  realtime:realtime
+                                  sequence:++_positionSequence
+                                 timestamp:timestamp];
 }
 
 - (void)viewControllerDidChangeSize:(CGSize)size {
@@ -751,6 +978,22 @@ using namespace facebook::react;
 
 #pragma mark - Private Helpers
 
+/**
+ * Flags the sheets from `controller` up when more than one goes away. UIKit animates only the
+ * topmost one and removes the rest with it, so the flag keeps those from regaining focus.
+ */
++ (void)markStackDismissFrom:(UIViewController *)controller {
+  if (!controller.presentedViewController) {
+    return;
+  }
+
+  for (UIViewController *vc = controller; vc != nil; vc = vc.presentedViewController) {
+    if ([vc isKindOfClass:[TrueSheetViewController class]]) {
+      ((TrueSheetViewController *)vc).isPendingStackDismiss = YES;
+    }
+  }
+}
+
 - (void)setupScrollable {
   if (!_containerView)
     return;
@@ -761,30 +1004,52 @@ using namespace facebook::react;
   [_containerView setupScrollable];
 }
 
+/**
+ * Runs the reconfiguration stages invalidated since the last update.
+ */
 - (void)applySheetPropsUpdate {
+  TrueSheetPropStage stages = _dirtyStages;
+  _dirtyStages = 0;
+
   BOOL pendingLayoutUpdate = _pendingLayoutUpdate;
   _pendingLayoutUpdate = NO;
 
   if (_pendingDetents) {
     _controller.detents = _pendingDetents;
     _pendingDetents = nil;
+    stages |= TrueSheetPropStageDetents;
   }
 
-  UIView *presenterView = _controller.presentingViewController.view;
-  [_controller setupAnchorViewInView:presenterView];
+  if (stages & TrueSheetPropStageAnchor) {
+    UIView *presenterView = _controller.presentingViewController.view;
+    [_controller setupAnchorViewInView:presenterView];
+  }
 
-  [_controller setupSheetSizing];
+  if (stages & TrueSheetPropStageSizing) {
+    [_controller setupSheetSizing];
+  }
 
-  [_controller.sheetPresentationController animateChanges:^{
-    [self->_controller setupSheetProps];
-    if (pendingLayoutUpdate) {
-      [self->_controller setupSheetDetentsForDetentsChange];
-    } else {
-      [self->_controller setupSheetDetents];
-    }
-    [self->_controller applyActiveDetent];
-  }];
-  [_controller setupDraggable];
+  if (stages & (TrueSheetPropStageAppearance | TrueSheetPropStageDetents)) {
+    [_controller.sheetPresentationController animateChanges:^{
+      if (stages & TrueSheetPropStageAppearance) {
+        [self->_controller setupSheetProps];
+      }
+      if (stages & TrueSheetPropStageDetents) {
+        if (pendingLayoutUpdate) {
+          [self->_controller setupSheetDetentsForDetentsChange];
+        } else {
+          [self->_controller setupSheetDetents];
+        }
+        [self->_controller applyActiveDetent];
+      }
+    }];
+  }
+
+  if (stages & TrueSheetPropStageDraggable) {
+    [_controller setupDraggable];
+  }
+
+  TrueSheetMetrics::shared().recordPropTransaction(__builtin_popcountl(stages));
 }
 
 - (UIViewController *)findPresentingViewController {
@@ -31,6 +31,10 @@ NS_ASSUME_NONNULL_BEGIN
                         index:(NSInteger)index
                      position:(CGFloat)position
                        detent:(CGFloat)detent;
+- (void)viewControllerWillSettleAtIndex:(NSInteger)index
+                               position:(CGFloat)position
+                                 detent:(CGFloat)detent
+                               duration:(CGFloat)duration;
 - (void)viewControllerDidChangePosition:(CGFloat)index
                                position:(CGFloat)position
                                  detent:(CGFloat)detent
@@ -86,6 +90,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, assign) BOOL keyboardSheetGrown;
 @property (nonatomic, readonly) BOOL isTopmostPresentedController;
+
+/**
+ * YES while the sheet goes away as part of a stack dismissal, where UIKit only animates the
+ * topmost sheet. Its dismiss events are emitted even if it isn't the one being dismissed, and
+ * it never regains focus from the sheets above it.
+ */
+@property (nonatomic, assign) BOOL isPendingStackDismiss;
 @property (nonatomic, weak, nullable) UIView *accessibilityContentView;
 
 @property (nonatomic, readonly) CGFloat screenHeight;
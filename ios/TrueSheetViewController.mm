@@ -21,6 +21,7 @@
 #import <React/RCTScrollViewComponentView.h>
 #import <objc/runtime.h>
 #import <react/renderer/components/TrueSheetSpec/Props.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetMetrics.h>
 
 using namespace facebook::react;
 
@@ -34,6 +35,11 @@ static BOOL TrueSheetPositionStateEquals(TrueSheetPositionState a, TrueSheetPosi
   return fabs(a.position - b.position) <= 0.01 && fabs(a.detent - b.detent) <= 0.01 && fabs(a.index - b.index) <= 0.01;
 }
 
+// Releases slower than this (pt/s) settle at the nearest detent
+static const CGFloat kSettleRestVelocity = 300.0;
+// Approximate length of UIKit's detent spring animation
+static const CGFloat kSettleDuration = 500.0;
+
 static char TrueSheetAccessibilityWindowOwnerKey;
 static char TrueSheetAccessibilityWindowPreviousElementsKey;
 
@@ -406,27 +412,33 @@ static char TrueSheetAccessibilityWindowPreviousElementsKey;
 }
 
 - (void)emitWillDismissEvents {
-  if (self.isBeingDismissed && !_isWillDismissEmitted) {
+  if ((self.isBeingDismissed || _isPendingStackDismiss) && !_isWillDismissEmitted) {
     _isWillDismissEmitted = YES;
 
     [self.delegate viewControllerWillBlur];
     [self.delegate viewControllerWillDismiss];
-    [_parentSheetController.delegate viewControllerWillFocus];
+    if (!_parentSheetController.isPendingStackDismiss) {
+      [_parentSheetController.delegate viewControllerWillFocus];
+    }
   }
 }
 
 - (void)emitDidDismissEvents {
-  if (self.isBeingDismissed) {
+  if (self.isBeingDismissed || _isPendingStackDismiss) {
     [self restoreWindowAccessibilityElements];
     _isPresented = NO;
     _isWillDismissEmitted = NO;
+    _isPendingStackDismiss = NO;
 
     [_anchorView removeFromSuperview];
     _anchorView = nil;
 
-    [_parentSheetController.delegate viewControllerDidFocus];
-    [_parentSheetController setSheetAccessibilityElementsHidden:NO];
-    [_parentSheetController setupAccessibilityContainer];
+    // The parent goes away in the same stack dismissal
+    if (!_parentSheetController.isPendingStackDismiss) {
+      [_parentSheetController.delegate viewControllerDidFocus];
+      [_parentSheetController setSheetAccessibilityElementsHidden:NO];
+      [_parentSheetController setupAccessibilityContainer];
+    }
     _parentSheetController = nil;
 
     [self.delegate viewControllerDidBlur];
@@ -594,6 +606,9 @@ static char TrueSheetAccessibilityWindowPreviousElementsKey;
       break;
     case UIGestureRecognizerStateEnded:
     case UIGestureRecognizerStateCancelled: {
+      // Window velocity; the presented view moves with the finger
+      [self emitWillSettleWithVelocity:[gesture velocityInView:nil].y];
+
       if (!_isTransitioning) {
         dispatch_async(dispatch_get_main_queue(), ^{
           NSInteger index = self.currentDetentIndex;
@@ -610,6 +625,28 @@ static char TrueSheetAccessibilityWindowPreviousElementsKey;
   }
 }
 
+/**
+ UIKit doesn't report the detent a released drag settles at until the animation is underway,
+ so it's predicted from the release velocity and the resolved detent heights.
+ */
+- (void)emitWillSettleWithVelocity:(CGFloat)velocity {
+  CGFloat currentPosition = self.currentPosition;
+  NSInteger index = [_detentCalculator predictSettleIndexForPosition:currentPosition
+                                                            velocity:velocity
+                                                        restVelocity:kSettleRestVelocity
+                                                         dismissible:self.dismissible];
+
+  CGFloat position = self.screenHeight;
+  CGFloat detent = 0;
+  if (index >= 0) {
+    position = self.screenHeight - [_detentCalculator resolvedHeightForIndex:index];
+    detent = [self detentValueForIndex:index];
+  }
+
+  CGFloat duration = fabs(position - currentPosition) >= 1 ? kSettleDuration : 0;
+  [self.delegate viewControllerWillSettleAtIndex:index position:position detent:detent duration:duration];
+}
+
 - (void)setupTransitionTracker {
   if (!self.transitionCoordinator)
     return;
@@ -896,8 +933,9 @@ static char TrueSheetAccessibilityWindowPreviousElementsKey;
     return;
   }
 
+  TrueSheetMetrics::shared().recordDetentReconfiguration();
   NSMutableArray<UISheetPresentationControllerDetent *> *detents = [NSMutableArray array];
-  [_detentCalculator clearResolvedHeights];
+  [_detentCalculator reloadDetents];
 
   CGFloat autoHeight = [self.contentHeight floatValue] + [self.headerHeight floatValue];
 
@@ -909,7 +947,6 @@ static char TrueSheetAccessibilityWindowPreviousElementsKey;
     [detents addObject:sheetDetent];
   }
 
-  [_detentCalculator setDetentCount:self.detents.count];
   sheet.detents = detents;
 
   if (self.dimmed && [self.dimmedDetentIndex integerValue] == 0) {
@@ -989,10 +1026,7 @@ static char TrueSheetAccessibilityWindowPreviousElementsKey;
                         CGFloat adjustedHeight = height - bottomAdjustment;
                         CGFloat resolved = fmin(adjustedHeight, maxValue);
 
-                        NSMutableArray *heights = self->_detentCalculator.resolvedDetentHeights;
-                        if (heights && index >= 0 && index < (NSInteger)heights.count) {
-                          heights[index] = @(resolved);
-                        }
+                        [self->_detentCalculator setResolvedHeight:resolved forIndex:index];
 
                         return resolved;
                       }];
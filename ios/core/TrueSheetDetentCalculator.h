@@ -28,12 +28,13 @@ NS_ASSUME_NONNULL_BEGIN
 
 /**
  Encapsulates all detent-related calculations for the sheet.
+ Backed by the shared C++ TrueSheetDetentEngine; delegate values are synced
+ into it once per query instead of being read per detent.
  */
 @interface TrueSheetDetentCalculator : NSObject
 
 @property (nonatomic, weak, nullable) id<TrueSheetDetentCalculatorDelegate> delegate;
 @property (nonatomic, assign) CGFloat maxDetentHeight;
-@property (nonatomic, strong, nullable) NSMutableArray<NSNumber *> *resolvedDetentHeights;
 
 /**
  Returns the detent value (0-1 fraction) for a given index.
@@ -83,15 +84,26 @@ NS_ASSUME_NONNULL_BEGIN
 - (CGFloat)interpolatedDetentForPosition:(CGFloat)position;
 
 /**
- Clears all resolved heights and learned offsets.
- Called when detents configuration changes.
+ Predicts the detent index a drag released at a position settles at, or -1 when it dismisses.
+ velocity: Release velocity in points per second, positive when the sheet moves down
+ restVelocity: Releases slower than this settle at the nearest detent
  */
-- (void)clearResolvedHeights;
+- (NSInteger)predictSettleIndexForPosition:(CGFloat)position
+                                  velocity:(CGFloat)velocity
+                              restVelocity:(CGFloat)restVelocity
+                               dismissible:(BOOL)dismissible;
 
 /**
- Sets the count of detents (initializes storage for resolved positions).
+ Stores the UIKit-resolved height for a detent index.
+ Called from the custom detent resolver.
+ */
+- (void)setResolvedHeight:(CGFloat)height forIndex:(NSInteger)index;
+
+/**
+ Reloads detents from the delegate and clears all resolved heights and learned offsets.
+ Called when detents configuration changes.
  */
-- (void)setDetentCount:(NSInteger)count;
+- (void)reloadDetents;
 
 @end
 
@@ -8,181 +8,111 @@
 
 #import "TrueSheetDetentCalculator.h"
 
-@implementation TrueSheetDetentCalculator {
-  NSMutableArray<NSNumber *> *_resolvedDetentOffsets;
-}
+#import <react/renderer/components/TrueSheetSpec/TrueSheetDetentEngine.h>
 
-#pragma mark - Public Methods
+#include <vector>
 
-- (CGFloat)detentValueForIndex:(NSInteger)index {
-  NSArray<NSNumber *> *detents = self.delegate.detents;
-  if (index >= 0 && index < (NSInteger)detents.count) {
-    CGFloat value = [detents[index] doubleValue];
-    if (value == -1) {
-      CGFloat autoHeight = [self.delegate.contentHeight floatValue] + [self.delegate.headerHeight floatValue];
-      return autoHeight / self.delegate.screenHeight;
-    }
-    if (value == -2) {
-      return [self peekHeight] / self.delegate.screenHeight;
-    }
-    return value;
-  }
-  return 0;
-}
+using namespace facebook::react;
 
-- (CGFloat)peekHeight {
-  CGFloat height = [self.delegate.headerHeight floatValue] + [self.delegate.footerHeight floatValue] +
-                   [self.delegate.peekContentHeight floatValue];
-  return height > 0 ? height : 150;
+@implementation TrueSheetDetentCalculator {
+  TrueSheetDetentEngine _engine;
+  NSArray<NSNumber *> *_syncedDetents;
 }
 
-- (void)learnOffsetForDetentIndex:(NSInteger)index {
-  if (index < 0 || !_resolvedDetentHeights || index >= (NSInteger)_resolvedDetentHeights.count) {
-    return;
-  }
+#pragma mark - Engine Sync
 
-  CGFloat actualHeight = self.delegate.screenHeight - self.delegate.currentPosition;
-  CGFloat resolverHeight = [_resolvedDetentHeights[index] doubleValue];
-  // Always update — system offset can change between detent transitions
-  if (resolverHeight > 0 && actualHeight > 0) {
-    _resolvedDetentOffsets[index] = @(actualHeight - resolverHeight);
-  }
-}
-
-- (CGFloat)resolvedHeightForIndex:(NSInteger)index {
-  if (_resolvedDetentHeights && index >= 0 && index < (NSInteger)_resolvedDetentHeights.count) {
-    CGFloat h = [_resolvedDetentHeights[index] doubleValue];
-    if (h > 0) {
-      // Use per-detent offset if learned, otherwise find any known offset
-      CGFloat offset = [self offsetForIndex:index];
-      return h + offset;
-    }
-  }
+- (void)syncDetents:(NSArray<NSNumber *> *)detents {
+  _syncedDetents = detents;
 
-  CGFloat detentValue = [self detentValueForIndex:index];
-  if (_maxDetentHeight > 0) {
-    return detentValue * _maxDetentHeight;
+  std::vector<double> values;
+  values.reserve(detents.count);
+  for (NSNumber *detent in detents) {
+    values.push_back([detent doubleValue]);
   }
-  return detentValue * self.delegate.screenHeight;
+  _engine.setDetents(values.data(), values.size());
 }
 
-- (CGFloat)offsetForIndex:(NSInteger)index {
-  // Use this detent's own offset if available
-  if (index >= 0 && index < (NSInteger)_resolvedDetentOffsets.count) {
-    CGFloat offset = [_resolvedDetentOffsets[index] doubleValue];
-    if (offset != 0)
-      return offset;
+/**
+ Pushes the delegate's current measurements into the engine.
+ Detents are only re-read when the delegate hands out a different array.
+ */
+- (void)syncEngine {
+  id<TrueSheetDetentCalculatorDelegate> delegate = self.delegate;
+  NSArray<NSNumber *> *detents = delegate.detents;
+  if (detents != _syncedDetents) {
+    [self syncDetents:detents];
   }
 
-  // Fall back to any known offset
-  for (NSInteger i = 0; i < (NSInteger)_resolvedDetentOffsets.count; i++) {
-    CGFloat offset = [_resolvedDetentOffsets[i] doubleValue];
-    if (offset != 0)
-      return offset;
-  }
-
-  return 0;
+  TrueSheetDetentLayout layout = _engine.getLayout();
+  layout.screenHeight = delegate.screenHeight;
+  layout.contentHeight = [delegate.contentHeight doubleValue];
+  layout.headerHeight = [delegate.headerHeight doubleValue];
+  layout.footerHeight = [delegate.footerHeight doubleValue];
+  layout.peekContentHeight = [delegate.peekContentHeight doubleValue];
+  layout.maxDetentHeight = _maxDetentHeight;
+  _engine.setLayout(layout);
 }
 
-- (BOOL)findSegmentForPosition:(CGFloat)position outIndex:(NSInteger *)outIndex outProgress:(CGFloat *)outProgress {
-  NSArray<NSNumber *> *detents = self.delegate.detents;
-  NSInteger count = detents.count;
-  if (count == 0) {
-    *outIndex = -1;
-    *outProgress = 0;
-    return NO;
-  }
-
-  CGFloat screenHeight = self.delegate.screenHeight;
-  CGFloat sheetHeight = screenHeight - position;
-  CGFloat firstHeight = [self resolvedHeightForIndex:0];
-
-  // Below first detent - interpolating toward closed
-  if (sheetHeight < firstHeight) {
-    *outIndex = -1;
-    *outProgress = firstHeight > 0 ? (firstHeight - sheetHeight) / firstHeight : 0;
-    return NO;
-  }
+#pragma mark - Public Methods
 
-  // Single detent
-  if (count == 1) {
-    *outIndex = 0;
-    *outProgress = 0;
-    return NO;
-  }
+- (CGFloat)detentValueForIndex:(NSInteger)index {
+  [self syncEngine];
+  return _engine.getDetentValue((int)index);
+}
 
-  CGFloat lastHeight = [self resolvedHeightForIndex:count - 1];
+- (CGFloat)peekHeight {
+  [self syncEngine];
+  return _engine.getPeekHeight();
+}
 
-  // Above last detent
-  if (sheetHeight > lastHeight) {
-    *outIndex = count - 1;
-    *outProgress = 0;
-    return NO;
-  }
+- (void)learnOffsetForDetentIndex:(NSInteger)index {
+  [self syncEngine];
+  CGFloat actualHeight = self.delegate.screenHeight - self.delegate.currentPosition;
+  _engine.learnOffset((int)index, actualHeight);
+}
 
-  // Between detents
-  for (NSInteger i = 0; i < count - 1; i++) {
-    CGFloat h = [self resolvedHeightForIndex:i];
-    CGFloat nextH = [self resolvedHeightForIndex:i + 1];
-
-    if (sheetHeight >= h && sheetHeight <= nextH) {
-      CGFloat range = nextH - h;
-      *outIndex = i;
-      *outProgress = range > 0 ? (sheetHeight - h) / range : 0;
-      return YES;
-    }
-  }
+- (CGFloat)resolvedHeightForIndex:(NSInteger)index {
+  [self syncEngine];
+  return _engine.getResolvedHeight((int)index);
+}
 
-  *outIndex = count - 1;
-  *outProgress = 0;
-  return NO;
+- (BOOL)findSegmentForPosition:(CGFloat)position outIndex:(NSInteger *)outIndex outProgress:(CGFloat *)outProgress {
+  [self syncEngine];
+  TrueSheetDetentSegment segment = _engine.findSegment(_engine.getLayout().screenHeight - position);
+  *outIndex = segment.fromIndex;
+  *outProgress = segment.progress;
+  return segment.between;
 }
 
 - (CGFloat)interpolatedIndexForPosition:(CGFloat)position {
-  NSInteger index;
-  CGFloat progress;
-  BOOL found = [self findSegmentForPosition:position outIndex:&index outProgress:&progress];
-
-  if (!found) {
-    if (index == -1) {
-      return -progress;
-    }
-    return index;
-  }
-
-  return index + fmax(0, fmin(1, progress));
+  [self syncEngine];
+  return _engine.getInterpolatedIndex(_engine.getLayout().screenHeight - position);
 }
 
 - (CGFloat)interpolatedDetentForPosition:(CGFloat)position {
-  NSInteger index;
-  CGFloat progress;
-  BOOL found = [self findSegmentForPosition:position outIndex:&index outProgress:&progress];
-
-  if (!found) {
-    if (index == -1) {
-      CGFloat firstDetent = [self detentValueForIndex:0];
-      return fmax(0, firstDetent * (1 - progress));
-    }
-    return [self detentValueForIndex:index];
-  }
+  [self syncEngine];
+  return _engine.getInterpolatedDetent(_engine.getLayout().screenHeight - position);
+}
 
-  CGFloat detent = [self detentValueForIndex:index];
-  CGFloat nextDetent = [self detentValueForIndex:index + 1];
-  return detent + progress * (nextDetent - detent);
+- (NSInteger)predictSettleIndexForPosition:(CGFloat)position
+                                  velocity:(CGFloat)velocity
+                              restVelocity:(CGFloat)restVelocity
+                               dismissible:(BOOL)dismissible {
+  [self syncEngine];
+  TrueSheetSettleRelease release;
+  release.sheetHeight = _engine.getLayout().screenHeight - position;
+  release.velocity = -velocity;
+  release.restVelocity = restVelocity;
+  release.dismissible = dismissible;
+  return _engine.predictSettleIndex(release);
 }
 
-- (void)clearResolvedHeights {
-  [_resolvedDetentHeights removeAllObjects];
-  [_resolvedDetentOffsets removeAllObjects];
+- (void)setResolvedHeight:(CGFloat)height forIndex:(NSInteger)index {
+  _engine.setResolverHeight((int)index, height);
 }
 
-- (void)setDetentCount:(NSInteger)count {
-  _resolvedDetentHeights = [NSMutableArray arrayWithCapacity:count];
-  _resolvedDetentOffsets = [NSMutableArray arrayWithCapacity:count];
-  for (NSInteger i = 0; i < count; i++) {
-    [_resolvedDetentHeights addObject:@(0)];
-    [_resolvedDetentOffsets addObject:@(0)];
-  }
+- (void)reloadDetents {
+  [self syncDetents:self.delegate.detents];
 }
 
 @end
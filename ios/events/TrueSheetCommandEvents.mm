@@ -0,0 +1,32 @@
+//
+//  Created by Jovanni Lo (@lodev09)
+//  Copyright (c) 2024-present. All rights reserved.
+//
+//  This source code is licensed under the MIT license found in the
+//  LICENSE file in the root directory of this source tree.
+//
+
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#import "TrueSheetCommandEvents.h"
+
+@implementation TrueSheetCommandEvents
+
++ (void)emitCommandComplete:(std::shared_ptr<const facebook::react::EventEmitter>)eventEmitter
+                  commandId:(NSInteger)commandId
+                      error:(nullable NSString *)error
+                 superseded:(BOOL)superseded {
+  if (!eventEmitter)
+    return;
+
+  auto emitter = std::static_pointer_cast<TrueSheetViewEventEmitter const>(eventEmitter);
+  TrueSheetViewEventEmitter::OnCommandComplete event;
+  event.id = static_cast<int>(commandId);
+  event.error = error ? std::string([error UTF8String]) : std::string();
+  event.superseded = static_cast<bool>(superseded);
+  emitter->onCommandComplete(event);
+}
+
+@end
+
+#endif  // RCT_NEW_ARCH_ENABLED
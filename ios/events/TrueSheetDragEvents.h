@@ -25,13 +25,21 @@ NS_ASSUME_NONNULL_BEGIN
 + (void)emitDragChange:(std::shared_ptr<const facebook::react::EventEmitter>)eventEmitter
                  index:(NSInteger)index
               position:(CGFloat)position
-                detent:(CGFloat)detent;
+                detent:(CGFloat)detent
+              sequence:(NSInteger)sequence
+             timestamp:(CFTimeInterval)timestamp;
 
 + (void)emitDragEnd:(std::shared_ptr<const facebook::react::EventEmitter>)eventEmitter
               index:(NSInteger)index
            position:(CGFloat)position
              detent:(CGFloat)detent;
 
++ (void)emitWillSettle:(std::shared_ptr<const facebook::react::EventEmitter>)eventEmitter
+                 index:(NSInteger)index
+              position:(CGFloat)position
+                detent:(CGFloat)detent
+              duration:(CGFloat)duration;
+
 @end
 
 NS_ASSUME_NONNULL_END
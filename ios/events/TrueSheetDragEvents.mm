@@ -30,7 +30,9 @@
 + (void)emitDragChange:(std::shared_ptr<const facebook::react::EventEmitter>)eventEmitter
                  index:(NSInteger)index
               position:(CGFloat)position
-                detent:(CGFloat)detent {
+                detent:(CGFloat)detent
+              sequence:(NSInteger)sequence
+             timestamp:(CFTimeInterval)timestamp {
   if (!eventEmitter)
     return;
 
@@ -39,6 +41,8 @@
   event.index = static_cast<int>(index);
   event.position = static_cast<double>(position);
   event.detent = static_cast<double>(detent);
+  event.sequence = static_cast<int>(sequence);
+  event.timestamp = static_cast<double>(timestamp);
   emitter->onDragChange(event);
 }
 
@@ -57,6 +61,23 @@
   emitter->onDragEnd(event);
 }
 
++ (void)emitWillSettle:(std::shared_ptr<const facebook::react::EventEmitter>)eventEmitter
+                 index:(NSInteger)index
+              position:(CGFloat)position
+                detent:(CGFloat)detent
+              duration:(CGFloat)duration {
+  if (!eventEmitter)
+    return;
+
+  auto emitter = std::static_pointer_cast<TrueSheetViewEventEmitter const>(eventEmitter);
+  TrueSheetViewEventEmitter::OnWillSettle event;
+  event.index = static_cast<int>(index);
+  event.position = static_cast<double>(position);
+  event.detent = static_cast<double>(detent);
+  event.duration = static_cast<double>(duration);
+  emitter->onWillSettle(event);
+}
+
 @end
 
 #endif  // RCT_NEW_ARCH_ENABLED
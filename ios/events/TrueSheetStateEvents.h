@@ -26,7 +26,9 @@ NS_ASSUME_NONNULL_BEGIN
                      index:(CGFloat)index
                   position:(CGFloat)position
                     detent:(CGFloat)detent
-                  realtime:(BOOL)realtime;
+                  realtime:(BOOL)realtime
+                  sequence:(NSInteger)sequence
+                 timestamp:(CFTimeInterval)timestamp;
 
 @end
 
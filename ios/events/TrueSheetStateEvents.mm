@@ -31,7 +31,9 @@
                      index:(CGFloat)index
                   position:(CGFloat)position
                     detent:(CGFloat)detent
-                  realtime:(BOOL)realtime {
+                  realtime:(BOOL)realtime
+                  sequence:(NSInteger)sequence
+                 timestamp:(CFTimeInterval)timestamp {
   if (!eventEmitter)
     return;
 
@@ -41,6 +43,8 @@
   event.position = static_cast<double>(position);
   event.detent = static_cast<double>(detent);
   event.realtime = static_cast<bool>(realtime);
+  event.sequence = static_cast<int>(sequence);
+  event.timestamp = static_cast<double>(timestamp);
   emitter->onPositionChange(event);
 }
 
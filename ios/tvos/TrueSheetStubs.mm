@@ -15,9 +15,12 @@
 #if TARGET_OS_TV && defined(RCT_NEW_ARCH_ENABLED)
 
 #import <React/RCTBridgeModule.h>
+#import <React/RCTFollyConvert.h>
 #import <React/RCTViewComponentView.h>
 
 #import <react/renderer/components/TrueSheetSpec/ComponentDescriptors.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetMeasuredViewComponentDescriptors.h>
+#import <react/renderer/components/TrueSheetSpec/TrueSheetMetrics.h>
 #import <react/renderer/components/TrueSheetSpec/TrueSheetViewComponentDescriptor.h>
 
 #import <TrueSheetSpec/TrueSheetSpec.h>
@@ -147,6 +150,13 @@ RCT_EXPORT_MODULE(TrueSheetModule)
   resolve(nil);
 }
 
+- (NSDictionary *)getMetrics {
+  return convertFollyDynamicToId(TrueSheetMetricsSnapshot{}.getDynamic());
+}
+
+- (void)resetMetrics {
+}
+
 @end
 
 #endif  // TARGET_OS_TV && RCT_NEW_ARCH_ENABLED
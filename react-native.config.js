@@ -3,7 +3,12 @@ module.exports = {
     platforms: {
       ios: {},
       android: {
-        componentDescriptors: ['TrueSheetViewComponentDescriptor'],
+        componentDescriptors: [
+          'TrueSheetViewComponentDescriptor',
+          'TrueSheetContentViewComponentDescriptor',
+          'TrueSheetHeaderViewComponentDescriptor',
+          'TrueSheetFooterViewComponentDescriptor',
+        ],
         cmakeListsPath: '../android/src/main/jni/CMakeLists.txt',
       },
     },
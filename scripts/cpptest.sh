@@ -0,0 +1,14 @@
+#!/bin/bash
+
+# Builds common/cpp on the host and runs its unit tests. Pass --bench to also run the benchmarks.
+set -e
+
+BUILD_DIR=common/__tests__/build
+
+cmake -S common/__tests__ -B "$BUILD_DIR"
+cmake --build "$BUILD_DIR" -j
+ctest --test-dir "$BUILD_DIR" --output-on-failure
+
+if [[ "$1" == "--bench" && -x "$BUILD_DIR/truesheet_common_benchmarks" ]]; then
+  "$BUILD_DIR/truesheet_common_benchmarks"
+fi
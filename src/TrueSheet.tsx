@@ -15,6 +15,7 @@ import type {
   DragBeginEvent,
   DragChangeEvent,
   DragEndEvent,
+  WillSettleEvent,
   DetentChangeEvent,
   WillPresentEvent,
   DidPresentEvent,
@@ -26,6 +27,10 @@ import type {
   DidFocusEvent,
   WillBlurEvent,
   DidBlurEvent,
+  TrueSheetPositionChannel,
+  TrueSheetMetrics,
+  TrueSheetCommand,
+  TrueSheetCommandStatus,
 } from './TrueSheet.types';
 import TrueSheetViewNativeComponent from './fabric/TrueSheetViewNativeComponent';
 import TrueSheetContainerViewNativeComponent from './fabric/TrueSheetContainerViewNativeComponent';
@@ -56,6 +61,42 @@ if (!TrueSheetModule) {
   throw new Error(LINKING_ERROR);
 }
 
+// Must match `TrueSheetCommandType` in common/cpp
+const NativeCommandType = {
+  present: 0,
+  resize: 1,
+  dismiss: 2,
+  dismissStack: 3,
+} as const;
+
+interface NativeCommand {
+  tag: number;
+  type: (typeof NativeCommandType)[TrueSheetCommand['type']];
+  index: number;
+  animated: boolean;
+  id: number;
+}
+
+interface NativeCommandQueue {
+  /**
+   * Queues the commands as one batch for the UI thread. Returns how many were queued.
+   */
+  apply(commands: NativeCommand[]): number;
+}
+
+interface PendingCommand {
+  resolve: (status: TrueSheetCommandStatus) => void;
+  reject: (error: Error) => void;
+}
+
+declare global {
+  // Installed by TrueSheetModule's JSI bindings
+  var __TrueSheetPositionChannel: ((viewTag: number) => TrueSheetPositionChannel | null) | undefined;
+  var __TrueSheetCommands: NativeCommandQueue | undefined;
+  // Called by the command queue for commands whose sheet is gone by the time they run
+  var __TrueSheetCommandFailed: ((id: number, error: string) => void) | undefined;
+}
+
 type NativeRef = ComponentRef<typeof TrueSheetViewNativeComponent>;
 
 // Stop raw touch events from bubbling past the sheet to outside ancestors
@@ -74,8 +115,18 @@ const stopResponderNegotiation = (event: GestureResponderEvent) => {
   return false;
 };
 
+interface PresentRequest {
+  index: number;
+  animated: boolean;
+  id: number;
+}
+
 interface TrueSheetState {
   shouldRenderNativeView: boolean;
+  /**
+   * Present that native runs as soon as the native view mounts
+   */
+  presentRequest: PresentRequest | null;
 }
 
 export class TrueSheet
@@ -88,6 +139,8 @@ export class TrueSheet
 
   private cachedGrabberOptions: TrueSheetProps['grabberOptions'] | undefined;
   private resolvedGrabberOptions: Record<string, unknown> | undefined;
+  private cachedPositionChangePolicy: TrueSheetProps['positionChangePolicy'] | undefined;
+  private resolvedPositionChangePolicy: Record<string, unknown> | undefined;
   private backHandlerSubscription: NativeEventSubscription | null = null;
   private isPresented: boolean = false;
   private isSheetVisible: boolean = true;
@@ -102,11 +155,53 @@ export class TrueSheet
    */
   private presentationResolver: (() => void) | null = null;
 
+  /**
+   * Pending native view mount, shared by `present()` and `prewarm()`
+   */
+  private mountPromise: Promise<void> | null = null;
+
+  /**
+   * Keeps the native view rendered after dismiss once prewarmed
+   */
+  private isPrewarmed: boolean = false;
+
   /**
    * Tracks if a present operation is in progress
    */
   private isPresenting: boolean = false;
 
+  /**
+   * Command id of the pending `presentRequest`. Native runs each request once and completes it
+   * through `onCommandComplete`.
+   */
+  private presentRequestId: number | null = null;
+
+  /**
+   * Queued native commands by id, settled on `onCommandComplete`
+   */
+  private readonly pendingCommands = new Map<number, PendingCommand>();
+
+  private static lastCommandId: number = 0;
+
+  /**
+   * Sheets by pending command id, so commands that native can't report through a sheet still settle
+   */
+  private static readonly commandSheets = new Map<number, TrueSheet>();
+
+  /**
+   * Settles a command native couldn't report through its sheet, e.g. because it was gone.
+   * Installed as the command queue's failure handler when this module loads.
+   * @internal
+   */
+  public static failCommand(id: number, error: string): void {
+    TrueSheet.commandSheets.get(id)?.settleCommand(id, error, false);
+  }
+
+  /**
+   * Open `applyCommands()` batch. Commands queued while it is set are applied together.
+   */
+  private static commandBatch: NativeCommand[] | null = null;
+
   constructor(props: TrueSheetProps) {
     super(props);
 
@@ -114,12 +209,14 @@ export class TrueSheet
 
     this.validateDetents();
 
-    // Lazy load by default, except when initialDetentIndex is set (for auto-presentation)
+    // Lazy load by default, except when prewarmed or initialDetentIndex is set (for auto-presentation)
     const shouldRenderImmediately =
-      props.initialDetentIndex !== undefined && props.initialDetentIndex >= 0;
+      props.prewarm === true ||
+      (props.initialDetentIndex !== undefined && props.initialDetentIndex >= 0);
 
     this.state = {
       shouldRenderNativeView: shouldRenderImmediately,
+      presentRequest: null,
     };
 
     this.onMount = this.onMount.bind(this);
@@ -131,6 +228,7 @@ export class TrueSheet
     this.onDragBegin = this.onDragBegin.bind(this);
     this.onDragChange = this.onDragChange.bind(this);
     this.onDragEnd = this.onDragEnd.bind(this);
+    this.onWillSettle = this.onWillSettle.bind(this);
     this.onPositionChange = this.onPositionChange.bind(this);
     this.onWillFocus = this.onWillFocus.bind(this);
     this.onDidFocus = this.onDidFocus.bind(this);
@@ -138,18 +236,12 @@ export class TrueSheet
     this.onDidBlur = this.onDidBlur.bind(this);
     this.handleBackPress = this.handleBackPress.bind(this);
     this.onVisibilityChange = this.onVisibilityChange.bind(this);
+    this.onCommandComplete = this.onCommandComplete.bind(this);
   }
 
   private validateDetents(): void {
     const { detents, initialDetentIndex } = this.props;
 
-    // Warn if detents length exceeds 3
-    if (detents && detents.length > 3) {
-      console.warn(
-        `TrueSheet: detents array has ${detents.length} items but maximum is 3. Only the first 3 will be used.`
-      );
-    }
-
     // Warn for invalid detent fractions
     if (detents) {
       detents.forEach((detent, index) => {
@@ -165,7 +257,7 @@ export class TrueSheet
 
     // Validate initialDetentIndex bounds
     if (initialDetentIndex !== undefined && initialDetentIndex >= 0) {
-      const detentsLength = Math.min(detents?.length ?? 2, 3); // Max 3 detents
+      const detentsLength = detents?.length ?? 2;
       if (initialDetentIndex >= detentsLength) {
         throw new Error(
           `TrueSheet: initialDetentIndex (${initialDetentIndex}) is out of bounds. detents array has ${detentsLength} item(s)`
@@ -262,6 +354,21 @@ export class TrueSheet
     return instance.resize(index);
   }
 
+  /**
+   * Prewarm the sheet by given `name` so its first present skips native view creation
+   * @param name - Sheet name
+   * @returns Promise that resolves when the native view is mounted
+   * @throws Error if sheet not found
+   */
+  public static async prewarm(name: string): Promise<void> {
+    const instance = TrueSheet.getInstance(name);
+    if (!instance) {
+      throw new Error(`Sheet with name "${name}" not found`);
+    }
+
+    return instance.prewarm();
+  }
+
   /**
    * Dismiss all presented sheets by dismissing from the bottom of the stack.
    * This ensures child sheets are dismissed first before their parent.
@@ -272,6 +379,67 @@ export class TrueSheet
     return TrueSheetModule?.dismissAll(animated);
   }
 
+  /**
+   * Run several sheet commands together, in order.
+   * Commands are queued natively as one batch that the UI thread runs in a single pass, and
+   * commands made redundant by a later one for the same sheet are skipped. Sheets that are
+   * presented but not rendered yet, or still mounting, are mounted before the batch is queued,
+   * so no command in it waits for a mount on its own.
+   * @param commands - Commands to run
+   * @returns Promise that resolves with each command's status once all of them have ended
+   * @throws Error if a sheet is not found
+   */
+  public static async applyCommands(
+    commands: TrueSheetCommand[]
+  ): Promise<TrueSheetCommandStatus[]> {
+    const instances = commands.map((command) => {
+      const instance = TrueSheet.getInstance(command.name);
+      if (!instance) {
+        throw new Error(`Sheet with name "${command.name}" not found`);
+      }
+
+      return instance;
+    });
+
+    // Only wait when a sheet has to mount, so batches of mounted sheets are queued synchronously
+    const mounts = instances.filter(
+      (instance, i) =>
+        instance.mountPromise !== null ||
+        (commands[i]!.type === 'present' && !instance.state.shouldRenderNativeView)
+    );
+    if (mounts.length > 0) {
+      await Promise.all(mounts.map((instance) => instance.renderNativeView()));
+    }
+
+    // Instance methods queue synchronously up to their first await, so with every sheet mounted
+    // each command lands in this batch
+    const batch: NativeCommand[] = [];
+    TrueSheet.commandBatch = batch;
+    const completions = commands.map((command, i) => instances[i]!.runCommand(command));
+    TrueSheet.commandBatch = null;
+
+    if (batch.length > 0) {
+      globalThis.__TrueSheetCommands?.apply(batch);
+    }
+
+    return Promise.all(completions);
+  }
+
+  /**
+   * Snapshot of the native performance counters shared by all sheets.
+   * Returns `null` on web.
+   */
+  public static getMetrics(): TrueSheetMetrics | null {
+    return TrueSheetModule?.getMetrics() ?? null;
+  }
+
+  /**
+   * Reset all native performance counters.
+   */
+  public static resetMetrics(): void {
+    TrueSheetModule?.resetMetrics();
+  }
+
   private registerInstance(): void {
     if (this.props.name) {
       TrueSheet.instances[this.props.name] = this;
@@ -318,8 +486,8 @@ export class TrueSheet
 
     // Clean up native view after dismiss for lazy loading.
     // Skip unmount if a present is in progress to avoid race condition.
-    if (!this.isPresenting) {
-      this.setState({ shouldRenderNativeView: false });
+    if (!this.isPresenting && !this.isPrewarmed && !this.props.prewarm) {
+      this.setState({ shouldRenderNativeView: false, presentRequest: null });
     }
 
     this.props.onDidDismiss?.(event);
@@ -330,6 +498,7 @@ export class TrueSheet
     if (this.presentationResolver) {
       this.presentationResolver();
       this.presentationResolver = null;
+      this.mountPromise = null;
     }
 
     this.props.onMount?.(event);
@@ -347,6 +516,10 @@ export class TrueSheet
     this.props.onDragEnd?.(event);
   }
 
+  private onWillSettle(event: WillSettleEvent): void {
+    this.props.onWillSettle?.(event);
+  }
+
   private onPositionChange(event: PositionChangeEvent): void {
     this.props.onPositionChange?.(event);
   }
@@ -371,6 +544,116 @@ export class TrueSheet
     this.isSheetVisible = event.nativeEvent.visible;
   }
 
+  private onCommandComplete(event: {
+    nativeEvent: { id: number; error: string; superseded: boolean };
+  }): void {
+    const { id, error, superseded } = event.nativeEvent;
+    this.settleCommand(id, error, superseded);
+  }
+
+
+  private settleCommand(id: number, error: string, superseded: boolean): void {
+    const pending = this.pendingCommands.get(id);
+    if (!pending) return;
+
+    this.pendingCommands.delete(id);
+    TrueSheet.commandSheets.delete(id);
+    if (id === this.presentRequestId) {
+      this.presentRequestId = null;
+    }
+    if (error) {
+      pending.reject(new Error(error));
+    } else {
+      pending.resolve(superseded ? 'superseded' : 'completed');
+    }
+  }
+
+  private runCommand(command: TrueSheetCommand): Promise<TrueSheetCommandStatus> {
+    switch (command.type) {
+      case 'present':
+        return this.presentCommand(command.index, command.animated);
+      case 'resize':
+        return this.sendCommand('resize', command.index, true);
+      case 'dismiss':
+        return this.sendCommand('dismiss', 0, command.animated ?? true);
+      case 'dismissStack':
+        return this.sendCommand('dismissStack', 0, command.animated ?? true);
+    }
+  }
+
+  /**
+   * Sends a command to the native view. With the JSI command queue installed, the command is
+   * queued (or added to the open `applyCommands()` batch) and completes through
+   * `onCommandComplete`, as `superseded` when a later command for this sheet replaced it.
+   * Otherwise it goes through the TurboModule.
+   */
+  private async sendCommand(
+    type: TrueSheetCommand['type'],
+    index: number,
+    animated: boolean
+  ): Promise<TrueSheetCommandStatus> {
+    if (type === 'dismiss') {
+      this.cancelPresentRequest('TrueSheet: sheet was dismissed before it was presented');
+    }
+
+    const queue = globalThis.__TrueSheetCommands;
+    if (!queue) {
+      return this.sendModuleCommand(type, index, animated);
+    }
+
+    const command: NativeCommand = {
+      tag: this.handle,
+      type: NativeCommandType[type],
+      index,
+      animated,
+      id: ++TrueSheet.lastCommandId,
+    };
+
+    const completion = this.trackCommand(command.id);
+
+    if (TrueSheet.commandBatch) {
+      TrueSheet.commandBatch.push(command);
+    } else {
+      queue.apply([command]);
+    }
+
+    return completion;
+  }
+
+  /**
+   * Registers a pending command, settled by `settleCommand`.
+   */
+  private trackCommand(id: number): Promise<TrueSheetCommandStatus> {
+    const completion = new Promise<TrueSheetCommandStatus>((resolve, reject) => {
+      this.pendingCommands.set(id, { resolve, reject });
+    });
+    TrueSheet.commandSheets.set(id, this);
+    return completion;
+  }
+
+  private async sendModuleCommand(
+    type: TrueSheetCommand['type'],
+    index: number,
+    animated: boolean
+  ): Promise<TrueSheetCommandStatus> {
+    switch (type) {
+      case 'present':
+        await TrueSheetModule?.presentByRef(this.handle, index, animated);
+        break;
+      case 'resize':
+        await TrueSheetModule?.resizeByRef(this.handle, index);
+        break;
+      case 'dismiss':
+        await TrueSheetModule?.dismissByRef(this.handle, animated);
+        break;
+      case 'dismissStack':
+        await TrueSheetModule?.dismissStackByRef(this.handle, animated);
+        break;
+    }
+
+    return 'completed';
+  }
+
   private handleBackPress(): boolean {
     if (!this.isPresented || !this.isSheetVisible) return false;
 
@@ -395,7 +678,14 @@ export class TrueSheet
    * @param animated - Whether to animate the presentation (default: true)
    */
   public async present(index: number = 0, animated: boolean = true): Promise<void> {
-    const detentsLength = Math.min(this.props.detents?.length ?? 2, 3); // Max 3 detents
+    await this.presentCommand(index, animated);
+  }
+
+  private async presentCommand(
+    index: number = 0,
+    animated: boolean = true
+  ): Promise<TrueSheetCommandStatus> {
+    const detentsLength = this.props.detents?.length ?? 2;
     if (index < 0 || index >= detentsLength) {
       throw new Error(
         `TrueSheet: present index (${index}) is out of bounds. detents array has ${detentsLength} item(s)`
@@ -403,17 +693,67 @@ export class TrueSheet
     }
 
     this.isPresenting = true;
+    try {
+      // Cold sheet: mount the native view and present it in the same commit, instead of
+      // waiting for `onMount` before calling into the native module.
+      if (!this.state.shouldRenderNativeView && !this.mountPromise) {
+        return await this.requestPresent(index, animated);
+      }
+
+      // Wait for a pending mount, e.g. from `prewarm()`
+      if (this.mountPromise) {
+        await this.mountPromise;
+      }
+
+      return await this.sendCommand('present', index, animated);
+    } finally {
+      this.isPresenting = false;
+    }
+  }
+
+  /**
+   * Mounts the native view with a `presentRequest`. The request is a pending command, so it
+   * settles like one: on `onCommandComplete`, when native fails it, on `dismiss()` and on unmount.
+   */
+  private requestPresent(index: number, animated: boolean): Promise<TrueSheetCommandStatus> {
+    const id = ++TrueSheet.lastCommandId;
+    const completion = this.trackCommand(id);
+    this.presentRequestId = id;
+    this.setState({ shouldRenderNativeView: true, presentRequest: { index, animated, id } });
+    return completion;
+  }
 
-    // Lazy load: render native view if not already rendered
-    if (!this.state.shouldRenderNativeView) {
-      await new Promise<void>((resolve) => {
+  /**
+   * Rejects a `presentRequest` that native has not completed yet.
+   */
+  private cancelPresentRequest(reason: string): void {
+    const id = this.presentRequestId;
+    if (id === null) return;
+
+    this.presentRequestId = null;
+    this.settleCommand(id, reason, false);
+  }
+
+  /**
+   * Render the native view ahead of `present()` so the first present skips mounting it.
+   * The native view stays rendered after dismiss until the sheet unmounts.
+   */
+  public async prewarm(): Promise<void> {
+    this.isPrewarmed = true;
+    await this.renderNativeView();
+  }
+
+  private renderNativeView(): Promise<void> {
+    if (!this.mountPromise) {
+      if (this.state.shouldRenderNativeView) return Promise.resolve();
+
+      this.mountPromise = new Promise<void>((resolve) => {
         this.presentationResolver = resolve;
         this.setState({ shouldRenderNativeView: true });
       });
     }
 
-    await TrueSheetModule?.presentByRef(this.handle, index, animated);
-    this.isPresenting = false;
+    return this.mountPromise;
   }
 
   /**
@@ -421,7 +761,7 @@ export class TrueSheet
    * @param index - The detent index to resize to
    */
   public async resize(index: number): Promise<void> {
-    await TrueSheetModule?.resizeByRef(this.handle, index);
+    await this.sendCommand('resize', index, true);
   }
 
   /**
@@ -429,7 +769,7 @@ export class TrueSheet
    * @param animated - Whether to animate the dismissal (default: true)
    */
   public async dismiss(animated: boolean = true): Promise<void> {
-    return TrueSheetModule?.dismissByRef(this.handle, animated);
+    await this.sendCommand('dismiss', 0, animated);
   }
 
   /**
@@ -438,7 +778,19 @@ export class TrueSheet
    * @param animated - Whether to animate the dismissal (default: true)
    */
   public async dismissStack(animated: boolean = true): Promise<void> {
-    return TrueSheetModule?.dismissStackByRef(this.handle, animated);
+    await this.sendCommand('dismissStack', 0, animated);
+  }
+
+  /**
+   * Synchronous access to this sheet's position samples, without event dispatch.
+   * The channel can be captured by worklets and polled every frame.
+   * @returns The channel, or `null` if the native view is not mounted
+   */
+  public getPositionChannel(): TrueSheetPositionChannel | null {
+    const nodeHandle = findNodeHandle(this.nativeRef.current);
+    if (nodeHandle == null || nodeHandle === -1) return null;
+
+    return globalThis.__TrueSheetPositionChannel?.(nodeHandle) ?? null;
   }
 
   componentDidMount(): void {
@@ -452,6 +804,10 @@ export class TrueSheet
     if (prevProps.detents !== this.props.detents) {
       this.validateDetents();
     }
+
+    if (this.props.prewarm && !prevProps.prewarm) {
+      this.renderNativeView();
+    }
   }
 
   componentWillUnmount(): void {
@@ -459,6 +815,14 @@ export class TrueSheet
     this.backHandlerSubscription?.remove();
     this.backHandlerSubscription = null;
     this.presentationResolver = null;
+    this.presentRequestId = null;
+    this.mountPromise = null;
+
+    this.pendingCommands.forEach(({ reject }, id) => {
+      TrueSheet.commandSheets.delete(id);
+      reject(new Error('TrueSheet: sheet unmounted before the command completed'));
+    });
+    this.pendingCommands.clear();
   }
 
   render(): ReactNode {
@@ -484,6 +848,7 @@ export class TrueSheet
       scrollable = false,
       scrollableOptions,
       footerOptions,
+      positionChangePolicy,
       presentation = 'page',
       children,
       style,
@@ -495,8 +860,8 @@ export class TrueSheet
       ...rest
     } = this.props;
 
-    // Trim to max 3 detents and clamp fractions
-    const resolvedDetents = detents.slice(0, 3).map((detent) => {
+    // Clamp fractions
+    const resolvedDetents = detents.map((detent) => {
       if (detent === 'auto' || detent === -1) return -1;
       if (detent === 'peek' || detent === -2) return -2;
 
@@ -516,6 +881,15 @@ export class TrueSheet
       };
     }
 
+    // Cache positionChangePolicy so inline objects don't produce a new native prop every render
+    if (positionChangePolicy !== this.cachedPositionChangePolicy) {
+      this.cachedPositionChangePolicy = positionChangePolicy;
+      this.resolvedPositionChangePolicy =
+        typeof positionChangePolicy === 'object'
+          ? { maxHz: positionChangePolicy.maxHz, minDelta: positionChangePolicy.minDelta }
+          : { settledOnly: positionChangePolicy === 'settledOnly' };
+    }
+
     return (
       <TrueSheetViewNativeComponent
         {...rest}
@@ -542,6 +916,8 @@ export class TrueSheet
         scrollable={scrollable}
         scrollableOptions={scrollableOptions}
         footerOptions={footerOptions}
+        positionChangePolicy={this.resolvedPositionChangePolicy}
+        presentRequest={this.state.presentRequest ?? undefined}
         presentation={presentation}
         insetAdjustment={insetAdjustment}
         onMount={this.onMount}
@@ -553,12 +929,14 @@ export class TrueSheet
         onDragBegin={this.onDragBegin}
         onDragChange={this.onDragChange}
         onDragEnd={this.onDragEnd}
+        onWillSettle={this.onWillSettle}
         onPositionChange={this.onPositionChange}
         onWillFocus={this.onWillFocus}
         onDidFocus={this.onDidFocus}
         onWillBlur={this.onWillBlur}
         onDidBlur={this.onDidBlur}
         onVisibilityChange={this.onVisibilityChange}
+        onCommandComplete={this.onCommandComplete}
         // These must stay on this host view, not on the container. The container is
         // reparented into the native sheet, so this view is never a native ancestor of
         // the sheet content — this is the React-tree boundary between the sheet and
@@ -600,6 +978,8 @@ export class TrueSheet
 // Compile-time check: `TrueSheet`'s static surface must satisfy `TrueSheetStaticMethods`.
 TrueSheet satisfies TrueSheetStaticMethods;
 
+globalThis.__TrueSheetCommandFailed = TrueSheet.failCommand;
+
 const styles = StyleSheet.create({
   sheetView: {
     ...StyleSheet.absoluteFill,
@@ -22,7 +22,32 @@ export interface DetentInfoEventPayload {
   detent: number;
 }
 
-export interface PositionChangeEventPayload extends DetentInfoEventPayload {
+export interface SampleEventPayload extends DetentInfoEventPayload {
+  /**
+   * Monotonic sample counter for this sheet. Samples are coalesced while JS is busy,
+   * so a gap between consecutive events means stale samples were dropped.
+   */
+  sequence: number;
+  /**
+   * Monotonic frame timestamp in milliseconds. Only meaningful relative to other samples.
+   */
+  timestamp: number;
+}
+
+export type DragChangeEventPayload = SampleEventPayload;
+
+export interface WillSettleEventPayload extends DetentInfoEventPayload {
+  /**
+   * The predicted detent index the sheet settles at, or `-1` when it is expected to dismiss.
+   */
+  index: number;
+  /**
+   * Estimated duration of the settle animation in milliseconds.
+   */
+  duration: number;
+}
+
+export interface PositionChangeEventPayload extends SampleEventPayload {
   /**
    * Indicates whether the position value is real-time (e.g., during drag or animation tracking).
    * When false, the position should be animated in JS.
@@ -30,6 +55,123 @@ export interface PositionChangeEventPayload extends DetentInfoEventPayload {
   realtime: boolean;
 }
 
+export interface PositionSample {
+  /**
+   * The interpolated detent index. See `PositionChangeEventPayload.index`.
+   */
+  index: number;
+  /**
+   * The Y position of the sheet relative to the screen.
+   */
+  position: number;
+  /**
+   * The interpolated detent value (0-1).
+   */
+  detent: number;
+  /**
+   * Monotonic frame timestamp in milliseconds.
+   */
+  timestamp: number;
+  /**
+   * Sample number within the channel, starting at 1.
+   */
+  sequence: number;
+  /**
+   * `false` when the sheet jumped to this position without tracking the movement.
+   * Animate to it instead of applying it directly.
+   */
+  realtime: boolean;
+}
+
+/**
+ * Synchronous, lock-free view of a sheet's position samples.
+ * Native writes every sample into a shared ring; reading never dispatches an event,
+ * and the channel can be captured by worklets and polled every frame.
+ */
+export interface TrueSheetPositionChannel {
+  /**
+   * Sequence of the newest sample, `0` before the first one.
+   * Reading it snapshots that sample for the fields below.
+   */
+  readonly sequence: number;
+  /**
+   * Fields of the snapshot taken by the last `sequence` read or `seek()` on the same thread.
+   * Reading them allocates nothing, so they are what per-frame polling should use.
+   */
+  readonly index: number;
+  readonly position: number;
+  readonly detent: number;
+  readonly timestamp: number;
+  readonly realtime: boolean;
+  /**
+   * Snapshots the sample with the given `sequence`. Returns `false`, keeping the previous
+   * snapshot, if it was already overwritten.
+   */
+  seek(sequence: number): boolean;
+  /**
+   * Returns the newest sample, or `null` before the first one. Creates an object per call.
+   */
+  latest(): PositionSample | null;
+  /**
+   * Returns the sample with the given `sequence`, or `null` if it was already overwritten.
+   * The channel keeps the last 64 samples.
+   */
+  read(sequence: number): PositionSample | null;
+}
+
+/**
+ * Latency histogram summary in milliseconds.
+ * Percentiles are estimated from histogram buckets.
+ */
+export interface LatencyMetrics {
+  count: number;
+  mean: number;
+  min: number;
+  max: number;
+  p50: number;
+  p90: number;
+  p99: number;
+}
+
+/**
+ * Native performance counters shared by all sheets since launch or the last `resetMetrics()`.
+ */
+export interface TrueSheetMetrics {
+  /**
+   * From `present()` to `onDidPresent`.
+   */
+  presentLatency: LatencyMetrics;
+  /**
+   * From `dismiss()` (or the start of a swipe/back dismissal) to `onDidDismiss`.
+   */
+  dismissLatency: LatencyMetrics;
+  /**
+   * `onPositionChange` events dispatched to JS.
+   */
+  positionEventsEmitted: number;
+  /**
+   * Position samples replaced by a newer one before reaching JS. Always `0` on iOS.
+   */
+  positionEventsCoalesced: number;
+  /**
+   * Container size updates committed to the shadow tree.
+   */
+  stateUpdates: number;
+  /**
+   * Native detent reconfigurations, e.g. after content size or `detents` changes.
+   */
+  detentReconfigurations: number;
+  /**
+   * Prop transactions applied to presented sheets.
+   */
+  propTransactions: number;
+  /**
+   * Reconfiguration stages (background, grabber, detents, ...) run by those transactions.
+   * Stages whose props did not change are skipped.
+   */
+  reconfigurationStages: number;
+}
+
 export type MountEvent = NativeSyntheticEvent<null>;
 export type DetentChangeEvent = NativeSyntheticEvent<DetentInfoEventPayload>;
 export type WillPresentEvent = NativeSyntheticEvent<DetentInfoEventPayload>;
@@ -37,8 +179,9 @@ export type DidPresentEvent = NativeSyntheticEvent<DetentInfoEventPayload>;
 export type WillDismissEvent = NativeSyntheticEvent<null>;
 export type DidDismissEvent = NativeSyntheticEvent<null>;
 export type DragBeginEvent = NativeSyntheticEvent<DetentInfoEventPayload>;
-export type DragChangeEvent = NativeSyntheticEvent<DetentInfoEventPayload>;
+export type DragChangeEvent = NativeSyntheticEvent<DragChangeEventPayload>;
 export type DragEndEvent = NativeSyntheticEvent<DetentInfoEventPayload>;
+export type WillSettleEvent = NativeSyntheticEvent<WillSettleEventPayload>;
 export type PositionChangeEvent = NativeSyntheticEvent<PositionChangeEventPayload>;
 export type DidFocusEvent = NativeSyntheticEvent<null>;
 export type DidBlurEvent = NativeSyntheticEvent<null>;
@@ -211,6 +354,23 @@ export interface FooterOptions {
   keyboardOffset?: number;
 }
 
+/**
+ * How often `onPositionChange` fires while the sheet moves.
+ * Settle positions (`realtime: false`) are always delivered.
+ *
+ * - `'everyFrame'`: Every frame of movement.
+ * - `'settledOnly'`: Only when the sheet settles.
+ * - `{ maxHz, minDelta }`: At most `maxHz` events per second, and only once the position
+ *    moved at least `minDelta` points (dp on Android) from the last event. Either can be omitted.
+ */
+export type PositionChangePolicy =
+  | 'everyFrame'
+  | 'settledOnly'
+  | {
+      maxHz?: number;
+      minDelta?: number;
+    };
+
 /**
  * Options for customizing the blur effect.
  * Only applies when `backgroundBlur` is set.
@@ -327,7 +487,7 @@ export interface TrueSheetProps extends ViewProps {
   name?: string;
   /**
    * The detents you want the Sheet to support.
-   * Maximum of 3 detents only; collapsed, half-expanded, expanded.
+   * Any number of detents is supported.
    *
    * Example:
    * ```ts
@@ -365,6 +525,14 @@ export interface TrueSheetProps extends ViewProps {
    */
   initialDetentAnimated?: boolean;
 
+  /**
+   * Render the native sheet as soon as this component mounts instead of on the first `present()`.
+   * The native view stays rendered after dismiss, so every present skips mounting it.
+   *
+   * @default false
+   */
+  prewarm?: boolean;
+
   /**
    * The detent index that the sheet should start to dim the background.
    * This is ignored if `dimmed` is set to `false`.
@@ -552,6 +720,15 @@ export interface TrueSheetProps extends ViewProps {
    */
   footerOptions?: FooterOptions;
 
+  /**
+   * Limits how often `onPositionChange` fires while the sheet moves. Samples are dropped
+   * natively, before events are created, so throttled sheets don't pay for every frame.
+   *
+   * @platform android, ios
+   * @default 'everyFrame'
+   */
+  positionChangePolicy?: PositionChangePolicy;
+
   /**
    * Renders the sheet as a detached floating card, not attached to the bottom edge.
    *
@@ -619,6 +796,17 @@ export interface TrueSheetProps extends ViewProps {
    */
   onDragEnd?: (event: DragEndEvent) => void;
 
+  /**
+   * Called when a drag is released, before the sheet animates to its resting detent.
+   * Comes with the predicted target detent info and the estimated animation duration.
+   *
+   * The target is predicted from the release velocity and may differ from the detent
+   * reported by `onDetentChange` once the sheet settles.
+   *
+   * @platform android, ios
+   */
+  onWillSettle?: (event: WillSettleEvent) => void;
+
   /**
    * Called when the sheet's position changes.
    * This fires continuously during sheet position changes.
@@ -696,6 +884,23 @@ export interface TrueSheetMethods {
   dismissStack(animated?: boolean): Promise<void>;
 }
 
+/**
+ * A sheet command for `applyCommands()`, targeting the sheet with the given `name`.
+ */
+export type TrueSheetCommand =
+  | { type: 'present'; name: string; index?: number; animated?: boolean }
+  | { type: 'resize'; name: string; index: number }
+  | { type: 'dismiss'; name: string; animated?: boolean }
+  | { type: 'dismissStack'; name: string; animated?: boolean };
+
+/**
+ * How a command ended.
+ * - `completed`: the command ran.
+ * - `superseded`: a later command for the same sheet in the same batch made it redundant, so it
+ *   never ran. E.g. a resize followed by another resize, or a present followed by a dismiss.
+ */
+export type TrueSheetCommandStatus = 'completed' | 'superseded';
+
 /**
  * Static methods exposed on the `TrueSheet` component for controlling sheets by `name`.
  *
@@ -735,8 +940,25 @@ export interface TrueSheetStaticMethods {
    */
   dismissStack(name: string, animated?: boolean): Promise<void>;
 
+  /**
+   * Render the native view of the sheet with the given `name` ahead of its first present.
+   *
+   * @throws if no sheet with the given `name` is registered.
+   */
+  prewarm(name: string): Promise<void>;
+
   /**
    * Dismiss every presented sheet, from the top of the stack downward.
    */
   dismissAll(animated?: boolean): Promise<void>;
+
+  /**
+   * Run several sheet commands together, in order. On iOS and Android, commands for mounted
+   * sheets are queued natively as one batch and run in a single UI thread pass, so a multi-sheet
+   * flow lands in the same frame. Commands made redundant by a later one for the same sheet
+   * don't run and resolve as `superseded`.
+   *
+   * @throws if a command names a sheet that is not registered.
+   */
+  applyCommands(commands: TrueSheetCommand[]): Promise<TrueSheetCommandStatus[]>;
 }
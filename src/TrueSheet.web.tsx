@@ -27,6 +27,7 @@ import type {
   PositionChangeEvent,
   SheetDetent,
   TrueSheetMethods,
+  TrueSheetMetrics,
   TrueSheetProps,
   TrueSheetStaticMethods,
   WillBlurEvent,
@@ -487,11 +488,22 @@ const TrueSheetComponent = forwardRef<TrueSheetMethods, TrueSheetProps>((props,
     [computeDetentGeometry]
   );
 
+  // Per-sheet sample counters, matching the native `sequence` payload field
+  const positionSequenceRef = useRef(0);
+  const dragSequenceRef = useRef(0);
+
   const handlePositionChange = useCallback(
     (position: number) => {
       const { index, detent } = interpolateFromPosition(position);
       onPositionChangeRef.current?.({
-        nativeEvent: { index, position, detent, realtime: true },
+        nativeEvent: {
+          index,
+          position,
+          detent,
+          realtime: true,
+          sequence: ++positionSequenceRef.current,
+          timestamp: performance.now(),
+        },
       } as PositionChangeEvent);
     },
     [interpolateFromPosition]
@@ -618,7 +630,13 @@ const TrueSheetComponent = forwardRef<TrueSheetMethods, TrueSheetProps>((props,
       isDraggingRef.current = true;
       onDragBeginRef.current?.({ nativeEvent: computeDetentInfo(true) } as DragBeginEvent);
     }
-    onDragChangeRef.current?.({ nativeEvent: computeDetentInfo(true) } as DragChangeEvent);
+    onDragChangeRef.current?.({
+      nativeEvent: {
+        ...computeDetentInfo(true),
+        sequence: ++dragSequenceRef.current,
+        timestamp: performance.now(),
+      },
+    } as DragChangeEvent);
   }, [computeDetentInfo]);
   const handleRelease = useCallback(() => {
     if (!isDraggingRef.current) return;
@@ -1083,7 +1101,11 @@ const visuallyHiddenStyle: React.CSSProperties = {
 const STATIC_METHOD_ERROR =
   'Static methods are not supported on web. Use the useTrueSheet() hook instead.';
 
-export const TrueSheet = TrueSheetComponent as typeof TrueSheetComponent & TrueSheetStaticMethods;
+export const TrueSheet = TrueSheetComponent as typeof TrueSheetComponent &
+  TrueSheetStaticMethods & {
+    getMetrics(): TrueSheetMetrics | null;
+    resetMetrics(): void;
+  };
 
 const rejectStatic = async (): Promise<never> => {
   throw new Error(STATIC_METHOD_ERROR);
@@ -1094,3 +1116,9 @@ TrueSheet.dismiss = rejectStatic;
 TrueSheet.dismissStack = rejectStatic;
 TrueSheet.resize = rejectStatic;
 TrueSheet.dismissAll = rejectStatic;
+TrueSheet.applyCommands = rejectStatic;
+TrueSheet.prewarm = rejectStatic;
+
+// Metrics are collected natively only
+TrueSheet.getMetrics = () => null;
+TrueSheet.resetMetrics = () => {};
@@ -29,5 +29,6 @@ export function useTrueSheet(): TrueSheetStaticMethods {
     dismissStack: TrueSheet.dismissStack,
     resize: TrueSheet.resize,
     dismissAll: TrueSheet.dismissAll,
+    applyCommands: TrueSheet.applyCommands,
   };
 }
@@ -11,7 +11,11 @@ import {
   type RefObject,
 } from 'react';
 
-import type { TrueSheetMethods, TrueSheetStaticMethods } from './TrueSheet.types';
+import type {
+  TrueSheetCommandStatus,
+  TrueSheetMethods,
+  TrueSheetStaticMethods,
+} from './TrueSheet.types';
 
 type SheetRef = RefObject<TrueSheetMethods | null>;
 type NodeRef = RefObject<HTMLDivElement | null>;
@@ -137,6 +141,7 @@ export function useTrueSheet(): TrueSheetStaticMethods {
         dismiss: reject,
         dismissStack: reject,
         dismissAll: reject,
+        applyCommands: reject,
       };
     }
 
@@ -151,6 +156,30 @@ export function useTrueSheet(): TrueSheetStaticMethods {
           [...stack].reverse().map((entry) => entry.ref.current?.dismiss(animated))
         );
       },
+      applyCommands: (commands) => {
+        const sheets = commands.map((command) => ctx.resolveByName(command.name));
+        // Web has no native batch, so every command runs
+        return Promise.all(
+          commands.map(async (command, i): Promise<TrueSheetCommandStatus> => {
+            const sheet = sheets[i]!;
+            switch (command.type) {
+              case 'present':
+                await sheet.present(command.index, command.animated);
+                break;
+              case 'resize':
+                await sheet.resize(command.index);
+                break;
+              case 'dismiss':
+                await sheet.dismiss(command.animated);
+                break;
+              case 'dismissStack':
+                await sheet.dismissStack(command.animated);
+                break;
+            }
+            return 'completed';
+          })
+        );
+      },
     };
   }, [ctx]);
 }
@@ -1,12 +1,14 @@
 import { Text } from 'react-native';
 import { render, act } from '@testing-library/react-native';
 import { TrueSheet, TrueSheetPeek } from '../index';
+import TrueSheetModule from '../specs/NativeTrueSheetModule';
 import type {
   DidDismissEvent,
   WillFocusEvent,
   DidFocusEvent,
   WillBlurEvent,
   DidBlurEvent,
+  WillSettleEvent,
 } from '../TrueSheet.types';
 
 describe('TrueSheet', () => {
@@ -35,6 +37,16 @@ describe('TrueSheet', () => {
     expect(typeof TrueSheet.dismissAll).toBe('function');
   });
 
+  it('should have prewarm static method', () => {
+    expect(TrueSheet.prewarm).toBeDefined();
+    expect(typeof TrueSheet.prewarm).toBe('function');
+  });
+
+  it('should have getMetrics and resetMetrics static methods', () => {
+    expect(typeof TrueSheet.getMetrics).toBe('function');
+    expect(typeof TrueSheet.resetMetrics).toBe('function');
+  });
+
   it('should render TrueSheet component without crashing', () => {
     const { getByText } = render(
       <TrueSheet name="test" initialDetentIndex={0}>
@@ -76,6 +88,18 @@ describe('TrueSheet', () => {
     expect(getByText('Detent Content')).toBeDefined();
   });
 
+  it('should accept more than 3 detents without warning', () => {
+    const warnSpy = jest.spyOn(console, 'warn').mockImplementation(() => {});
+    const { getByText } = render(
+      <TrueSheet name="test" detents={[0.2, 0.4, 0.6, 0.8, 1]} initialDetentIndex={4}>
+        <Text>Many Detents</Text>
+      </TrueSheet>
+    );
+    expect(getByText('Many Detents')).toBeDefined();
+    expect(warnSpy).not.toHaveBeenCalled();
+    warnSpy.mockRestore();
+  });
+
   it('should render with style prop', () => {
     const { getByText } = render(
       <TrueSheet name="test" initialDetentIndex={0} style={{ padding: 20 }}>
@@ -85,6 +109,27 @@ describe('TrueSheet', () => {
     expect(getByText('Styled Content')).toBeDefined();
   });
 
+  it('should pass positionChangePolicy to the native view', () => {
+    const { UNSAFE_root, rerender } = render(
+      <TrueSheet name="test" initialDetentIndex={0} positionChangePolicy={{ maxHz: 30 }}>
+        <Text>Policy Content</Text>
+      </TrueSheet>
+    );
+    const nativePolicy = () =>
+      UNSAFE_root.findAll(
+        (node) => typeof node.type === 'string' && node.props.positionChangePolicy !== undefined
+      )[0]?.props.positionChangePolicy;
+
+    expect(nativePolicy()).toEqual({ maxHz: 30, minDelta: undefined });
+
+    rerender(
+      <TrueSheet name="test" initialDetentIndex={0} positionChangePolicy="settledOnly">
+        <Text>Policy Content</Text>
+      </TrueSheet>
+    );
+    expect(nativePolicy()).toEqual({ settledOnly: true });
+  });
+
   describe('Lazy Loading', () => {
     it('should not render native view content initially when initialDetentIndex is not set', () => {
       const { queryByText } = render(
@@ -140,6 +185,86 @@ describe('TrueSheet', () => {
       expect(queryByText('Present Content')).not.toBeNull();
     });
 
+    it('should request the present in the same commit that mounts the native view', async () => {
+      const presentByRef = jest.mocked(TrueSheetModule!.presentByRef);
+      presentByRef.mockClear();
+
+      const { UNSAFE_root, queryByText } = render(
+        <TrueSheet name="present-request-test">
+          <Text>Request Content</Text>
+        </TrueSheet>
+      );
+      const sheetRef = (TrueSheet as any).instances['present-request-test'];
+      const presentRequest = () =>
+        UNSAFE_root.findAll(
+          (node) => typeof node.type === 'string' && node.props.presentRequest !== undefined
+        )[0]?.props.presentRequest;
+
+      expect(presentRequest()).toBeUndefined();
+
+      let presented = false;
+      await act(async () => {
+        sheetRef.present(1, false).then(() => {
+          presented = true;
+        });
+      });
+
+      expect(queryByText('Request Content')).not.toBeNull();
+      expect(presentRequest()).toMatchObject({ index: 1, animated: false });
+      expect(presentByRef).not.toHaveBeenCalled();
+      expect(presented).toBe(false);
+
+      await act(async () => {
+        sheetRef.onCommandComplete({
+          nativeEvent: { id: presentRequest().id, error: '', superseded: false },
+        });
+      });
+
+      expect(presented).toBe(true);
+      expect(sheetRef.isPresenting).toBe(false);
+    });
+
+    it('should reject a requested present that native fails', async () => {
+      const { UNSAFE_root } = render(
+        <TrueSheet name="present-request-error-test">
+          <Text>Content</Text>
+        </TrueSheet>
+      );
+      const sheetRef = (TrueSheet as any).instances['present-request-error-test'];
+
+      let presented: Promise<void> = Promise.resolve();
+      await act(async () => {
+        presented = sheetRef.present(0);
+      });
+      const request = UNSAFE_root.findAll(
+        (node) => typeof node.type === 'string' && node.props.presentRequest !== undefined
+      )[0]!.props.presentRequest;
+
+      sheetRef.onCommandComplete({
+        nativeEvent: { id: request.id, error: 'Present failed', superseded: false },
+      });
+      await expect(presented).rejects.toThrow('Present failed');
+      expect(sheetRef.isPresenting).toBe(false);
+    });
+
+    it('should reject a requested present when the sheet unmounts first', async () => {
+      const { unmount } = render(
+        <TrueSheet name="present-request-unmount-test">
+          <Text>Content</Text>
+        </TrueSheet>
+      );
+      const sheetRef = (TrueSheet as any).instances['present-request-unmount-test'];
+
+      let presented: Promise<void> = Promise.resolve();
+      await act(async () => {
+        presented = sheetRef.present(0);
+      });
+
+      unmount();
+      await expect(presented).rejects.toThrow('unmounted');
+      expect(sheetRef.isPresenting).toBe(false);
+    });
+
     it('should clean up native view content after dismiss', async () => {
       const onDidDismissMock = jest.fn();
       const { getByText, queryByText } = render(
@@ -165,6 +290,27 @@ describe('TrueSheet', () => {
       expect(onDidDismissMock).toHaveBeenCalled();
     });
 
+    it('should keep native view content rendered after dismiss when prewarmed', async () => {
+      const { getByText } = render(
+        <TrueSheet name="prewarm-test" prewarm>
+          <Text>Prewarm Content</Text>
+        </TrueSheet>
+      );
+
+      // Content should be rendered before present
+      expect(getByText('Prewarm Content')).toBeDefined();
+
+      const sheetRef = (TrueSheet as any).instances['prewarm-test'];
+      expect(sheetRef).toBeDefined();
+
+      await act(async () => {
+        sheetRef.onDidDismiss({} as DidDismissEvent);
+      });
+
+      // Content should survive dismiss
+      expect(getByText('Prewarm Content')).toBeDefined();
+    });
+
     it('should render footer only when native view is rendered', () => {
       const { queryByText } = render(
         <TrueSheet name="lazy-footer-test" footer={<Text>Lazy Footer</Text>}>
@@ -290,4 +436,181 @@ describe('TrueSheet', () => {
       expect(onDidBlurMock).toHaveBeenCalled();
     });
   });
+
+  describe('Drag Events', () => {
+    it('should call onWillSettle with the predicted target', async () => {
+      const onWillSettleMock = jest.fn();
+      render(
+        <TrueSheet name="will-settle-test" initialDetentIndex={0} onWillSettle={onWillSettleMock}>
+          <Text>Content</Text>
+        </TrueSheet>
+      );
+
+      const sheetRef = (TrueSheet as any).instances['will-settle-test'];
+      expect(sheetRef).toBeDefined();
+
+      const nativeEvent = { index: 1, position: 200, detent: 0.8, duration: 320 };
+      await act(async () => {
+        sheetRef.onWillSettle({ nativeEvent } as WillSettleEvent);
+      });
+
+      expect(onWillSettleMock).toHaveBeenCalledWith({ nativeEvent });
+    });
+  });
+
+  describe('Command Queue', () => {
+    const apply = jest.fn((commands: unknown[]) => commands.length);
+    let handleSpy: jest.SpyInstance;
+
+    beforeEach(() => {
+      apply.mockClear();
+      globalThis.__TrueSheetCommands = { apply };
+      handleSpy = jest.spyOn(TrueSheet.prototype as any, 'handle', 'get').mockReturnValue(42);
+    });
+
+    afterEach(() => {
+      globalThis.__TrueSheetCommands = undefined;
+      handleSpy.mockRestore();
+    });
+
+    it('should queue applyCommands as one native batch completed by events', async () => {
+      render(
+        <>
+          <TrueSheet name="batch-a" prewarm>
+            <Text>A</Text>
+          </TrueSheet>
+          <TrueSheet name="batch-b" prewarm>
+            <Text>B</Text>
+          </TrueSheet>
+        </>
+      );
+      const sheetA = (TrueSheet as any).instances['batch-a'];
+      const sheetB = (TrueSheet as any).instances['batch-b'];
+
+      let statuses: string[] | null = null;
+      TrueSheet.applyCommands([
+        { type: 'present', name: 'batch-a', index: 1 },
+        { type: 'resize', name: 'batch-b', index: 0 },
+      ]).then((result) => {
+        statuses = result;
+      });
+
+      expect(apply).toHaveBeenCalledTimes(1);
+      const batch = apply.mock.calls[0]![0] as { id: number }[];
+      expect(batch).toMatchObject([
+        { tag: 42, type: 0, index: 1, animated: true },
+        { tag: 42, type: 1, index: 0 },
+      ]);
+
+      await act(async () => {
+        sheetA.onCommandComplete({
+          nativeEvent: { id: batch[0]!.id, error: '', superseded: false },
+        });
+      });
+      expect(statuses).toBeNull();
+
+      await act(async () => {
+        sheetB.onCommandComplete({
+          nativeEvent: { id: batch[1]!.id, error: '', superseded: true },
+        });
+      });
+      expect(statuses).toEqual(['completed', 'superseded']);
+    });
+
+    it('should resolve a superseded command without rejecting', async () => {
+      render(
+        <TrueSheet name="command-superseded-test" prewarm>
+          <Text>Content</Text>
+        </TrueSheet>
+      );
+      const sheetRef = (TrueSheet as any).instances['command-superseded-test'];
+
+      const resized = sheetRef.resize(0);
+      const command = (apply.mock.calls[0]![0] as { id: number }[])[0]!;
+
+      sheetRef.onCommandComplete({ nativeEvent: { id: command.id, error: '', superseded: true } });
+      await expect(resized).resolves.toBeUndefined();
+    });
+
+    it('should reject a command that completes with an error', async () => {
+      render(
+        <TrueSheet name="command-error-test" prewarm>
+          <Text>Content</Text>
+        </TrueSheet>
+      );
+      const sheetRef = (TrueSheet as any).instances['command-error-test'];
+
+      const dismissed = sheetRef.dismiss();
+      const command = (apply.mock.calls[0]![0] as { id: number }[])[0]!;
+
+      sheetRef.onCommandComplete({
+        nativeEvent: { id: command.id, error: 'Dismiss failed', superseded: false },
+      });
+      await expect(dismissed).rejects.toThrow('Dismiss failed');
+    });
+
+    it('should reject a requested present when dismissed first', async () => {
+      render(
+        <TrueSheet name="present-request-dismiss-test">
+          <Text>Content</Text>
+        </TrueSheet>
+      );
+      const sheetRef = (TrueSheet as any).instances['present-request-dismiss-test'];
+
+      let presented: Promise<void> = Promise.resolve();
+      await act(async () => {
+        presented = sheetRef.present(0);
+      });
+
+      sheetRef.dismiss().catch(() => {});
+      await expect(presented).rejects.toThrow('dismissed before it was presented');
+      expect(sheetRef.isPresenting).toBe(false);
+    });
+
+    it('should reject a command whose sheet native no longer has', async () => {
+      render(
+        <TrueSheet name="command-failed-test" prewarm>
+          <Text>Content</Text>
+        </TrueSheet>
+      );
+      const sheetRef = (TrueSheet as any).instances['command-failed-test'];
+
+      const resized = sheetRef.resize(1);
+      const command = (apply.mock.calls[0]![0] as { id: number }[])[0]!;
+
+      globalThis.__TrueSheetCommandFailed?.(command.id, 'No sheet found with tag 42');
+      await expect(resized).rejects.toThrow('No sheet found with tag 42');
+    });
+
+    it('should mount cold sheets before queueing the applyCommands batch', async () => {
+      render(
+        <>
+          <TrueSheet name="cold-batch-a" prewarm>
+            <Text>A</Text>
+          </TrueSheet>
+          <TrueSheet name="cold-batch-b">
+            <Text>B</Text>
+          </TrueSheet>
+        </>
+      );
+      const sheetB = (TrueSheet as any).instances['cold-batch-b'];
+
+      await act(async () => {
+        TrueSheet.applyCommands([
+          { type: 'dismiss', name: 'cold-batch-a' },
+          { type: 'present', name: 'cold-batch-b', index: 0 },
+        ]).catch(() => {});
+      });
+      expect(apply).not.toHaveBeenCalled();
+
+      await act(async () => {
+        sheetB.onMount({ nativeEvent: {} });
+      });
+      expect(apply).toHaveBeenCalledTimes(1);
+      expect(apply.mock.calls[0]![0]).toMatchObject([
+        { tag: 42, type: 2 },
+        { tag: 42, type: 0, index: 0 },
+      ]);
+    });
+  });
 });
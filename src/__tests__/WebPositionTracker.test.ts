@@ -0,0 +1,149 @@
+import { TRANSITIONS } from '../web/vaul/constants';
+import { cubicBezier } from '../web/vaul/helpers';
+import { createPositionTracker } from '../web/vaul/position-tracker';
+
+type Listener = (event: any) => void;
+
+const DURATION = TRANSITIONS.DURATION * 1000;
+const FRAME = 1000 / 60;
+const ease = cubicBezier(...(TRANSITIONS.EASE as [number, number, number, number]));
+
+/** Minimal stand-in for an element: inline style, listeners, animations and a layout box. */
+const createElement = (layoutTop: () => number) => {
+  const listeners = new Map<string, Set<Listener>>();
+  const element = {
+    style: { transform: '' },
+    animations: [] as unknown[],
+    addEventListener: (type: string, listener: Listener) => {
+      if (!listeners.has(type)) listeners.set(type, new Set());
+      listeners.get(type)!.add(listener);
+    },
+    removeEventListener: (type: string, listener: Listener) => {
+      listeners.get(type)?.delete(listener);
+    },
+    dispatch: (type: string, event: object = {}) => {
+      listeners.get(type)?.forEach((listener) => listener({ target: element, ...event }));
+    },
+    getAnimations: () => element.animations,
+    getBoundingClientRect: jest.fn(() => ({ top: layoutTop() })),
+  };
+  return element;
+};
+
+const createTransition = (from: number, to: number) => ({
+  transitionProperty: 'transform',
+  effect: {
+    getKeyframes: () => [
+      { offset: 0, transform: `translate3d(0px, ${from}px, 0px)` },
+      { offset: 1, transform: `translate3d(0px, ${to}px, 0px)` },
+    ],
+    getComputedTiming: () => ({
+      duration: DURATION,
+      delay: 0,
+      easing: `cubic-bezier(${TRANSITIONS.EASE.join(', ')})`,
+    }),
+  },
+});
+
+describe('Web position tracker', () => {
+  let now = 0;
+  let frames: FrameRequestCallback[] = [];
+
+  const runFrames = (count: number) => {
+    for (let i = 0; i < count; i++) {
+      now += FRAME;
+      const pending = frames;
+      frames = [];
+      pending.forEach((callback) => callback(now));
+    }
+  };
+
+  beforeEach(() => {
+    now = 0;
+    frames = [];
+    jest.spyOn(performance, 'now').mockImplementation(() => now);
+    global.requestAnimationFrame = (callback) => frames.push(callback);
+    global.cancelAnimationFrame = jest.fn();
+  });
+
+  afterEach(() => {
+    jest.restoreAllMocks();
+  });
+
+  it('reads layout at most twice per transition', () => {
+    const drawer = createElement(() => 100 + 300 * ease(Math.min(1, now / DURATION)));
+    const onPosition = jest.fn();
+
+    const tracker = createPositionTracker(drawer as unknown as HTMLElement, null, {
+      current: onPosition,
+    });
+    drawer.getBoundingClientRect.mockClear();
+
+    drawer.style.transform = 'translate3d(0, 300px, 0)';
+    drawer.animations = [createTransition(0, 300)];
+    drawer.dispatch('transitionrun', { propertyName: 'transform' });
+    runFrames(Math.ceil(DURATION / FRAME) + 1);
+    drawer.dispatch('transitionend', { propertyName: 'transform' });
+
+    expect(drawer.getBoundingClientRect).toHaveBeenCalledTimes(2);
+    expect(onPosition).toHaveBeenLastCalledWith(400);
+
+    tracker.dispose();
+  });
+
+  it('follows the transition easing between layout reads', () => {
+    const drawer = createElement(() => 100 + 300 * ease(Math.min(1, now / DURATION)));
+    const positions: number[] = [];
+
+    createPositionTracker(drawer as unknown as HTMLElement, null, {
+      current: (position) => positions.push(position),
+    });
+
+    drawer.style.transform = 'translate3d(0, 300px, 0)';
+    drawer.animations = [createTransition(0, 300)];
+    drawer.dispatch('transitionrun', { propertyName: 'transform' });
+    runFrames(15);
+
+    const expected = 100 + 300 * ease((15 * FRAME) / DURATION);
+    expect(positions[positions.length - 1]).toBeCloseTo(expected, 5);
+    for (let i = 1; i < positions.length; i++) {
+      expect(positions[i]).toBeGreaterThanOrEqual(positions[i - 1]!);
+    }
+  });
+
+  it('tracks inline drag transforms without reading layout every frame', () => {
+    let offset = 0;
+    const drawer = createElement(() => 100 + offset);
+    const onPosition = jest.fn();
+
+    const tracker = createPositionTracker(drawer as unknown as HTMLElement, null, {
+      current: onPosition,
+    });
+    drawer.getBoundingClientRect.mockClear();
+
+    tracker.start();
+    for (offset = 10; offset <= 200; offset += 10) {
+      drawer.style.transform = `translate3d(0, ${offset}px, 0)`;
+      runFrames(1);
+    }
+
+    expect(drawer.getBoundingClientRect).toHaveBeenCalledTimes(1);
+    expect(onPosition).toHaveBeenLastCalledWith(300);
+
+    tracker.dispose();
+  });
+
+  it('measures every frame when the transform is not in pixels', () => {
+    const drawer = createElement(() => 100 + now);
+
+    createPositionTracker(drawer as unknown as HTMLElement, null, { current: jest.fn() });
+    drawer.getBoundingClientRect.mockClear();
+
+    drawer.style.transform = 'translate3d(0, 50%, 0)';
+    drawer.animations = [];
+    drawer.dispatch('transitionrun', { propertyName: 'transform' });
+    runFrames(10);
+
+    expect(drawer.getBoundingClientRect).toHaveBeenCalledTimes(10);
+  });
+});
@@ -0,0 +1,45 @@
+import { createVelocityTracker } from '../web/vaul/velocity-tracker';
+
+const pointerEvent = (timeStamp: number, pageY: number, coalesced: [number, number][] = []) =>
+  ({
+    timeStamp,
+    pageX: 0,
+    pageY,
+    getCoalescedEvents: () =>
+      coalesced.map(([time, y]) => ({ timeStamp: time, pageX: 0, pageY: y })),
+  }) as unknown as PointerEvent;
+
+describe('Web velocity tracker', () => {
+  it('needs at least two samples', () => {
+    const tracker = createVelocityTracker();
+    tracker.add(pointerEvent(0, 100), 100, true);
+
+    expect(tracker.velocity(0)).toBeNull();
+  });
+
+  it('uses coalesced pointer events within the recent window', () => {
+    const tracker = createVelocityTracker();
+    // Slow start, then a fast flick delivered as one coalesced move
+    tracker.add(pointerEvent(0, 100), 100, true);
+    tracker.add(pointerEvent(200, 110), 110, true);
+    tracker.add(
+      pointerEvent(240, 190, [
+        [220, 130],
+        [230, 160],
+        [240, 190],
+      ]),
+      190,
+      true
+    );
+
+    expect(tracker.velocity(240)).toBeCloseTo(2);
+  });
+
+  it('reports zero once the pointer has paused', () => {
+    const tracker = createVelocityTracker();
+    tracker.add(pointerEvent(0, 100), 100, true);
+    tracker.add(pointerEvent(16, 140), 140, true);
+
+    expect(tracker.velocity(300)).toBe(0);
+  });
+});
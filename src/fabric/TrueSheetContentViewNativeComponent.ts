@@ -5,4 +5,6 @@ export interface NativeProps extends ViewProps {
   // No props needed - size will be controlled by parent
 }
 
-export default codegenNativeComponent<NativeProps>('TrueSheetContentView', {});
+export default codegenNativeComponent<NativeProps>('TrueSheetContentView', {
+  interfaceOnly: true,
+});
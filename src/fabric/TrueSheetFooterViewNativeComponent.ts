@@ -5,4 +5,6 @@ export interface NativeProps extends ViewProps {
   // Footer-specific props can be added here if needed
 }
 
-export default codegenNativeComponent<NativeProps>('TrueSheetFooterView', {});
+export default codegenNativeComponent<NativeProps>('TrueSheetFooterView', {
+  interfaceOnly: true,
+});
@@ -5,4 +5,6 @@ export interface NativeProps extends ViewProps {
   // Header-specific props can be added here if needed
 }
 
-export default codegenNativeComponent<NativeProps>('TrueSheetHeaderView', {});
+export default codegenNativeComponent<NativeProps>('TrueSheetHeaderView', {
+  interfaceOnly: true,
+});
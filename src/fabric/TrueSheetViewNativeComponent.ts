@@ -45,19 +45,57 @@ type FooterOptionsType = Readonly<{
   keyboardOffset?: WithDefault<Double, 0>;
 }>;
 
+type PositionChangePolicyType = Readonly<{
+  settledOnly?: WithDefault<boolean, false>;
+  maxHz?: WithDefault<Double, 0>;
+  minDelta?: WithDefault<Double, 0>;
+}>;
+
 export interface DetentInfoEventPayload {
   index: Int32;
   position: Double;
   detent: Double;
 }
 
+export interface DragChangeEventPayload {
+  index: Int32;
+  position: Double;
+  detent: Double;
+  sequence: Int32;
+  timestamp: Double;
+}
+
+export interface WillSettleEventPayload {
+  index: Int32;
+  position: Double;
+  detent: Double;
+  duration: Double;
+}
+
+export interface CommandCompleteEventPayload {
+  id: Int32;
+  // Empty when the command succeeded
+  error: string;
+  // Made redundant by a later command for the same sheet, so it never ran
+  superseded: boolean;
+}
+
 export interface PositionChangeEventPayload {
   index: Double;
   position: Double;
   detent: Double;
   realtime: boolean;
+  sequence: Int32;
+  timestamp: Double;
 }
 
+// Presents the sheet as soon as its container mounts. `id` changes per request.
+type PresentRequestType = Readonly<{
+  index?: WithDefault<Int32, -1>;
+  animated?: WithDefault<boolean, true>;
+  id?: WithDefault<Int32, 0>;
+}>;
+
 export interface NativeProps extends ViewProps {
   // Array properties
   detents?: ReadonlyArray<Double>;
@@ -118,6 +156,8 @@ export interface NativeProps extends ViewProps {
   scrollable?: WithDefault<boolean, false>;
   scrollableOptions?: ScrollableOptionsType;
   footerOptions?: FooterOptionsType;
+  positionChangePolicy?: PositionChangePolicyType;
+  presentRequest?: PresentRequestType;
   presentation?: WithDefault<'page' | 'form', 'page'>;
 
   // Event handlers
@@ -128,14 +168,16 @@ export interface NativeProps extends ViewProps {
   onDidDismiss?: DirectEventHandler<null>;
   onDetentChange?: DirectEventHandler<DetentInfoEventPayload>;
   onDragBegin?: DirectEventHandler<DetentInfoEventPayload>;
-  onDragChange?: DirectEventHandler<DetentInfoEventPayload>;
+  onDragChange?: DirectEventHandler<DragChangeEventPayload>;
   onDragEnd?: DirectEventHandler<DetentInfoEventPayload>;
+  onWillSettle?: DirectEventHandler<WillSettleEventPayload>;
   onPositionChange?: DirectEventHandler<PositionChangeEventPayload>;
   onWillFocus?: DirectEventHandler<null>;
   onDidFocus?: DirectEventHandler<null>;
   onWillBlur?: DirectEventHandler<null>;
   onDidBlur?: DirectEventHandler<null>;
   onVisibilityChange?: DirectEventHandler<Readonly<{ visible: boolean }>>;
+  onCommandComplete?: DirectEventHandler<CommandCompleteEventPayload>;
 }
 
 export default codegenNativeComponent<NativeProps>('TrueSheetView', {
@@ -1,7 +1,12 @@
 import React, { createElement, isValidElement, type ReactNode } from 'react';
 import { View, type ViewProps } from 'react-native';
 
-import type { TrueSheetProps, TrueSheetStaticMethods } from '../TrueSheet.types';
+import type {
+  TrueSheetCommand,
+  TrueSheetCommandStatus,
+  TrueSheetProps,
+  TrueSheetStaticMethods,
+} from '../TrueSheet.types';
 
 interface TrueSheetState {
   shouldRenderNativeView: boolean;
@@ -21,11 +26,19 @@ export class TrueSheet extends React.Component<TrueSheetProps, TrueSheetState> {
   );
   static resize = jest.fn((_name: string, _index: number) => Promise.resolve());
   static dismissAll = jest.fn((_animated?: boolean) => Promise.resolve());
+  static applyCommands = jest.fn((commands: TrueSheetCommand[]) =>
+    Promise.resolve(commands.map((): TrueSheetCommandStatus => 'completed'))
+  );
+  static prewarm = jest.fn((_name: string) => Promise.resolve());
+  static getMetrics = jest.fn(() => null);
+  static resetMetrics = jest.fn();
 
   dismiss = jest.fn((_animated?: boolean) => Promise.resolve());
   dismissStack = jest.fn((_animated?: boolean) => Promise.resolve());
   present = jest.fn((_index?: number, _animated?: boolean) => Promise.resolve());
   resize = jest.fn((_index: number) => Promise.resolve());
+  prewarm = jest.fn(() => Promise.resolve());
+  getPositionChannel = jest.fn(() => null);
 
   componentDidMount() {
     const { name } = this.props;
@@ -83,6 +96,7 @@ export function useTrueSheet(): TrueSheetStaticMethods {
     dismissStack: TrueSheet.dismissStack,
     resize: TrueSheet.resize,
     dismissAll: TrueSheet.dismissAll,
+    applyCommands: TrueSheet.applyCommands,
   };
 }
 
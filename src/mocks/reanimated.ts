@@ -37,11 +37,14 @@ export class ReanimatedTrueSheet extends React.Component<TrueSheetProps, TrueShe
     Promise.resolve()
   );
   static resize = jest.fn((_name: string, _index: number) => Promise.resolve());
+  static prewarm = jest.fn((_name: string) => Promise.resolve());
 
   dismiss = jest.fn((_animated?: boolean) => Promise.resolve());
   dismissStack = jest.fn((_animated?: boolean) => Promise.resolve());
   present = jest.fn((_index?: number, _animated?: boolean) => Promise.resolve());
   resize = jest.fn((_index: number) => Promise.resolve());
+  prewarm = jest.fn(() => Promise.resolve());
+  getPositionChannel = jest.fn(() => null);
 
   componentDidMount() {
     const { name } = this.props;
@@ -86,7 +89,7 @@ export function ReanimatedTrueSheetProvider({ children }: { children: React.Reac
  * Mock useReanimatedTrueSheet hook for testing.
  */
 export const useReanimatedTrueSheet = jest.fn(
-  (): MockReanimatedTrueSheetContextValue => ({
+  (_name?: string): MockReanimatedTrueSheetContextValue => ({
     animatedPosition: createMockSharedValue(0),
     animatedIndex: createMockSharedValue(-1),
     animatedDetent: createMockSharedValue(0),
@@ -1,7 +1,9 @@
-import { forwardRef } from 'react';
+import { forwardRef, useCallback, useRef } from 'react';
 import Animated, {
   type WithSpringConfig,
   type WithTimingConfig,
+  useFrameCallback,
+  useSharedValue,
   withSpring,
   withTiming,
   Easing,
@@ -9,8 +11,19 @@ import Animated, {
 import { Platform } from 'react-native';
 
 import { TrueSheet } from '../TrueSheet';
-import type { TrueSheetProps, PositionChangeEvent } from '../TrueSheet.types';
-import { useReanimatedTrueSheet } from './ReanimatedTrueSheetProvider';
+import type {
+  TrueSheetProps,
+  PositionChangeEvent,
+  PositionSample,
+  TrueSheetPositionChannel,
+  WillPresentEvent,
+  DidDismissEvent,
+} from '../TrueSheet.types';
+import {
+  useReanimatedTrueSheet,
+  useReanimatedTrueSheetValues,
+  type ReanimatedTrueSheetContextValue,
+} from './ReanimatedTrueSheetProvider';
 import { useReanimatedPositionChangeHandler } from './useReanimatedPositionChangeHandler';
 
 const SPRING_CONFIG: WithSpringConfig = {
@@ -37,9 +50,43 @@ interface ReanimatedTrueSheetProps extends TrueSheetProps {
 // Create animated version of TrueSheet
 const AnimatedTrueSheet = Animated.createAnimatedComponent(TrueSheet);
 
+type PositionValues = Pick<PositionSample, 'position' | 'index' | 'detent' | 'realtime'>;
+
+const applyPositionChange = (
+  values: ReanimatedTrueSheetContextValue,
+  { position, index, detent, realtime }: PositionValues
+) => {
+  'worklet';
+
+  const { animatedPosition, animatedIndex, animatedDetent } = values;
+
+  if (realtime) {
+    // Update directly when we have real-time values (during drag or animation tracking)
+    animatedPosition.value = position;
+    animatedIndex.value = index;
+    animatedDetent.value = detent;
+  } else {
+    // Animate position, index, and detent when not real-time
+    if (Platform.OS === 'android') {
+      animatedPosition.value = withTiming(position, TIMING_CONFIG);
+      animatedIndex.value = withTiming(index, TIMING_CONFIG);
+      animatedDetent.value = withTiming(detent, TIMING_CONFIG);
+    } else {
+      animatedPosition.value = withSpring(position, SPRING_CONFIG);
+      animatedIndex.value = withSpring(index, SPRING_CONFIG);
+      animatedDetent.value = withSpring(detent, SPRING_CONFIG);
+    }
+  }
+};
+
 /**
  * Reanimated-enabled version of TrueSheet that automatically syncs position with the provider's shared value.
- * Must be used within a ReanimatedTrueSheetProvider.
+ * Must be used within a ReanimatedTrueSheetProvider. Named sheets also sync their own values,
+ * read with `useReanimatedTrueSheet(name)`.
+ *
+ * While presented, the shared values are read straight from the sheet's native position channel
+ * on every UI frame, so they update in the same frame the sheet moves without going through
+ * the event pipeline. Events are only used as a fallback when the channel is unavailable.
  *
  * NOTE: `onPositionChange` is now under UI thread.
  * Make sure you add `worklet` if you want to override this.
@@ -68,33 +115,88 @@ const AnimatedTrueSheet = Animated.createAnimatedComponent(TrueSheet);
  * ```
  */
 export const ReanimatedTrueSheet = forwardRef<TrueSheet, ReanimatedTrueSheetProps>((props, ref) => {
-  const { onPositionChange, ...rest } = props;
+  const { onPositionChange, onWillPresent, onDidDismiss, ...rest } = props;
+
+  const values = useReanimatedTrueSheet();
+  const sheetValues = useReanimatedTrueSheetValues(rest.name);
 
-  const { animatedPosition, animatedIndex, animatedDetent } = useReanimatedTrueSheet();
+  const sheetRef = useRef<TrueSheet | null>(null);
+  const positionChannel = useSharedValue<TrueSheetPositionChannel | null>(null);
+  const lastSequence = useSharedValue(0);
 
-  const positionChangeHandler = useReanimatedPositionChangeHandler((payload) => {
+  // Polls the channel on the UI thread while the sheet is presented; idle sheets don't run it
+  const positionBinding = useFrameCallback(() => {
     'worklet';
 
-    if (payload.realtime) {
-      // Update directly when we have real-time values (during drag or animation tracking)
-      animatedPosition.value = payload.position;
-      animatedIndex.value = payload.index;
-      animatedDetent.value = payload.detent;
-    } else {
-      // Animate position, index, and detent when not real-time
-      if (Platform.OS === 'android') {
-        animatedPosition.value = withTiming(payload.position, TIMING_CONFIG);
-        animatedIndex.value = withTiming(payload.index, TIMING_CONFIG);
-        animatedDetent.value = withTiming(payload.detent, TIMING_CONFIG);
-      } else {
-        animatedPosition.value = withSpring(payload.position, SPRING_CONFIG);
-        animatedIndex.value = withSpring(payload.index, SPRING_CONFIG);
-        animatedDetent.value = withSpring(payload.detent, SPRING_CONFIG);
+    const channel = positionChannel.value;
+    if (!channel) return;
+
+    // Reading `sequence` snapshots the newest sample; its fields are read straight off the
+    // channel, so polling creates no objects on the UI runtime
+    const sequence = channel.sequence;
+    if (sequence === 0 || sequence === lastSequence.value) return;
+    lastSequence.value = sequence;
+
+    applyPositionChange(values, channel);
+    if (sheetValues) {
+      applyPositionChange(sheetValues, channel);
+    }
+  }, false);
+
+  const setRef = useCallback(
+    (instance: TrueSheet | null) => {
+      sheetRef.current = instance;
+      if (typeof ref === 'function') {
+        ref(instance);
+      } else if (ref) {
+        ref.current = instance;
       }
+    },
+    [ref]
+  );
+
+  const handleWillPresent = (event: WillPresentEvent) => {
+    const channel = sheetRef.current?.getPositionChannel() ?? null;
+    if (channel) {
+      lastSequence.value = channel.sequence;
+      positionChannel.value = channel;
+      positionBinding.setActive(true);
     }
 
-    onPositionChange?.({ nativeEvent: payload } as PositionChangeEvent);
-  });
+    onWillPresent?.(event);
+  };
+
+  const handleDidDismiss = (event: DidDismissEvent) => {
+    positionBinding.setActive(false);
+    positionChannel.value = null;
+
+    onDidDismiss?.(event);
+  };
+
+  const positionChangeHandler = useReanimatedPositionChangeHandler(
+    (payload) => {
+      'worklet';
+
+      // Samples already reach the values through the channel binding
+      if (!positionChannel.value) {
+        applyPositionChange(values, payload);
+        if (sheetValues) {
+          applyPositionChange(sheetValues, payload);
+        }
+      }
+
+      onPositionChange?.({ nativeEvent: payload } as PositionChangeEvent);
+    },
+    [sheetValues]
+  );
 
-  return <AnimatedTrueSheet ref={ref} onPositionChange={positionChangeHandler} {...rest} />;
+  return (
+    <AnimatedTrueSheet
+      ref={setRef}
+      onPositionChange={positionChangeHandler}
+      onWillPresent={handleWillPresent}
+      onDidDismiss={handleDidDismiss}
+      {...rest}
+    />
+  );
 });
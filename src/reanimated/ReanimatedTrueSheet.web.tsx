@@ -3,7 +3,22 @@ import { useWindowDimensions } from 'react-native';
 
 import { TrueSheet } from '../TrueSheet';
 import type { TrueSheetProps, PositionChangeEvent } from '../TrueSheet.types';
-import { useReanimatedTrueSheet } from './ReanimatedTrueSheetProvider';
+import {
+  useReanimatedTrueSheet,
+  useReanimatedTrueSheetValues,
+  type ReanimatedTrueSheetContextValue,
+} from './ReanimatedTrueSheetProvider';
+
+const syncValues = (
+  values: ReanimatedTrueSheetContextValue,
+  position: number,
+  index: number,
+  detent: number
+) => {
+  values.animatedPosition.value = position;
+  values.animatedIndex.value = index;
+  values.animatedDetent.value = detent;
+};
 
 interface ReanimatedTrueSheetProps extends TrueSheetProps {
   /**
@@ -17,7 +32,7 @@ interface ReanimatedTrueSheetProps extends TrueSheetProps {
 /**
  * Reanimated-enabled version of TrueSheet for web that automatically syncs
  * position with the provider's shared value.
- * Must be used within a ReanimatedTrueSheetProvider.
+ * Must be used within a ReanimatedTrueSheetProvider. Named sheets also sync their own values.
  *
  * @example
  * ```tsx
@@ -46,24 +61,27 @@ export const ReanimatedTrueSheet = forwardRef<TrueSheet, ReanimatedTrueSheetProp
   const { onPositionChange, detents = [0.5, 1], ...rest } = props;
   const { height: windowHeight } = useWindowDimensions();
 
-  const { animatedPosition, animatedIndex, animatedDetent } = useReanimatedTrueSheet();
+  const values = useReanimatedTrueSheet();
+  const sheetValues = useReanimatedTrueSheetValues(rest.name);
 
   // Reset animated values when component unmounts
   useEffect(() => {
     return () => {
-      animatedPosition.value = windowHeight;
-      animatedIndex.value = -1;
-      animatedDetent.value = 0;
+      syncValues(values, windowHeight, -1, 0);
+      if (sheetValues) {
+        syncValues(sheetValues, windowHeight, -1, 0);
+      }
     };
-  }, [windowHeight]);
+  }, [windowHeight, sheetValues]);
 
   const handlePositionChange = (event: PositionChangeEvent) => {
     const { position, index, detent } = event.nativeEvent;
 
     // Sync with provider's shared values
-    animatedPosition.value = position;
-    animatedIndex.value = index;
-    animatedDetent.value = detent;
+    syncValues(values, position, index, detent);
+    if (sheetValues) {
+      syncValues(sheetValues, position, index, detent);
+    }
 
     // Call user's callback
     onPositionChange?.(event);
@@ -1,6 +1,6 @@
-import { createContext, useContext, useMemo, type ReactNode } from 'react';
+import { createContext, useContext, useEffect, useMemo, useRef, type ReactNode } from 'react';
 import { useWindowDimensions } from 'react-native';
-import { useSharedValue, type SharedValue } from 'react-native-reanimated';
+import { makeMutable, useSharedValue, type SharedValue } from 'react-native-reanimated';
 
 export interface ReanimatedTrueSheetContextValue {
   /**
@@ -19,7 +19,60 @@ export interface ReanimatedTrueSheetContextValue {
   animatedDetent: SharedValue<number>;
 }
 
+interface SheetValuesEntry {
+  values: ReanimatedTrueSheetContextValue;
+  refs: number;
+}
+
+/**
+ * Per-sheet shared values keyed by sheet `name`.
+ * Entries are created on first use and dropped once no sheet or subscriber holds them,
+ * so sheets nobody listens to only write values without dependents.
+ */
+class SheetValuesRegistry {
+  private entries = new Map<string, SheetValuesEntry>();
+
+  constructor(private readonly initialPosition: () => number) {}
+
+  get(name: string): ReanimatedTrueSheetContextValue {
+    let entry = this.entries.get(name);
+    if (!entry) {
+      entry = {
+        values: {
+          animatedPosition: makeMutable(this.initialPosition()),
+          animatedIndex: makeMutable(-1),
+          animatedDetent: makeMutable(0),
+        },
+        refs: 0,
+      };
+      this.entries.set(name, entry);
+    }
+    return entry.values;
+  }
+
+  retain(name: string, values: ReanimatedTrueSheetContextValue) {
+    let entry = this.entries.get(name);
+    if (!entry) {
+      // Released by another holder between render and commit
+      entry = { values, refs: 0 };
+      this.entries.set(name, entry);
+    }
+    entry.refs++;
+  }
+
+  release(name: string) {
+    const entry = this.entries.get(name);
+    if (!entry) return;
+
+    entry.refs--;
+    if (entry.refs <= 0) {
+      this.entries.delete(name);
+    }
+  }
+}
+
 const ReanimatedTrueSheetContext = createContext<ReanimatedTrueSheetContextValue | null>(null);
+const ReanimatedTrueSheetRegistryContext = createContext<SheetValuesRegistry | null>(null);
 
 export interface ReanimatedTrueSheetProviderProps {
   children: ReactNode;
@@ -48,22 +101,54 @@ export const ReanimatedTrueSheetProvider = ({ children }: ReanimatedTrueSheetPro
   const animatedIndex = useSharedValue(-1);
   const animatedDetent = useSharedValue(0);
 
+  const heightRef = useRef(height);
+  heightRef.current = height;
+
   const value = useMemo<ReanimatedTrueSheetContextValue>(
     () => ({ animatedPosition, animatedIndex, animatedDetent }),
     [animatedPosition, animatedIndex, animatedDetent]
   );
 
+  const registry = useMemo(() => new SheetValuesRegistry(() => heightRef.current), []);
+
   return (
-    <ReanimatedTrueSheetContext.Provider value={value}>
-      {children}
-    </ReanimatedTrueSheetContext.Provider>
+    <ReanimatedTrueSheetRegistryContext.Provider value={registry}>
+      <ReanimatedTrueSheetContext.Provider value={value}>
+        {children}
+      </ReanimatedTrueSheetContext.Provider>
+    </ReanimatedTrueSheetRegistryContext.Provider>
   );
 };
 
+/**
+ * Shared values of the sheet with the given `name`, held for as long as the caller is mounted.
+ * Returns `null` without a name or outside the provider.
+ *
+ * @internal
+ */
+export const useReanimatedTrueSheetValues = (
+  name: string | undefined
+): ReanimatedTrueSheetContextValue | null => {
+  const registry = useContext(ReanimatedTrueSheetRegistryContext);
+  const values = useMemo(() => (registry && name ? registry.get(name) : null), [registry, name]);
+
+  useEffect(() => {
+    if (!registry || !name || !values) return;
+
+    registry.retain(name, values);
+    return () => registry.release(name);
+  }, [registry, name, values]);
+
+  return values;
+};
+
 /**
  * Hook to access the Reanimated TrueSheet context.
  * Returns the shared values for sheet position and detent index that can be used in animations.
  *
+ * Without a `name`, the values follow whichever sheet moved last. Pass a sheet `name` to
+ * subscribe to that sheet only, so stacked sheets don't write into the same values.
+ *
  * @throws Error if used outside of ReanimatedTrueSheetProvider
  *
  * @example
@@ -82,8 +167,9 @@ export const ReanimatedTrueSheetProvider = ({ children }: ReanimatedTrueSheetPro
  * }
  * ```
  */
-export const useReanimatedTrueSheet = (): ReanimatedTrueSheetContextValue => {
+export const useReanimatedTrueSheet = (name?: string): ReanimatedTrueSheetContextValue => {
   const context = useContext(ReanimatedTrueSheetContext);
+  const sheetValues = useReanimatedTrueSheetValues(name);
 
   if (!context) {
     throw new Error(
@@ -92,5 +178,5 @@ export const useReanimatedTrueSheet = (): ReanimatedTrueSheetContextValue => {
     );
   }
 
-  return context;
+  return sheetValues ?? context;
 };
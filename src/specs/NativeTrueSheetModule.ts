@@ -8,6 +8,27 @@
 import type { TurboModule } from 'react-native';
 import { TurboModuleRegistry } from 'react-native';
 
+type LatencyMetrics = {
+  count: number;
+  mean: number;
+  min: number;
+  max: number;
+  p50: number;
+  p90: number;
+  p99: number;
+};
+
+type Metrics = {
+  presentLatency: LatencyMetrics;
+  dismissLatency: LatencyMetrics;
+  positionEventsEmitted: number;
+  positionEventsCoalesced: number;
+  stateUpdates: number;
+  detentReconfigurations: number;
+  propTransactions: number;
+  reconfigurationStages: number;
+};
+
 interface Spec extends TurboModule {
   /**
    * Present a sheet by reference
@@ -58,6 +79,17 @@ interface Spec extends TurboModule {
    * @param viewTag - Native view tag of the sheet component
    */
   handleBackPress(viewTag: number): Promise<void>;
+
+  /**
+   * Snapshot of the native performance counters shared by all sheets
+   * Latencies are in milliseconds
+   */
+  getMetrics(): Metrics;
+
+  /**
+   * Reset all performance counters
+   */
+  resetMetrics(): void;
 }
 
 export default TurboModuleRegistry.get<Spec>('TrueSheetModule');
@@ -1,4 +1,5 @@
 import React from 'react';
+import type { PositionTracker } from './position-tracker';
 import type { DrawerDirection } from './types';
 
 export interface DragEvent {
@@ -46,6 +47,7 @@ interface DrawerContextValue {
   autoFocus?: boolean;
   shouldAnimate?: React.RefObject<boolean>;
   onPositionChangeRef: React.RefObject<((position: number) => void) | undefined>;
+  positionTrackerRef: React.RefObject<PositionTracker | null>;
   setContentHeight: (height: number) => void;
   detached: boolean;
   detachedOffset: number;
@@ -86,6 +88,7 @@ export const DrawerContext = React.createContext<DrawerContextValue>({
   container: null,
   autoFocus: false,
   onPositionChangeRef: { current: undefined },
+  positionTrackerRef: { current: null },
   setContentHeight: () => {},
   detached: false,
   detachedOffset: 0,
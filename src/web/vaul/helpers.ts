@@ -122,3 +122,76 @@ export function chain<T>(...fns: T[]) {
     }
   };
 }
+
+/**
+ * Returns the vertical offset of an inline `transform` value in pixels, `0` when there is no
+ * transform, or `null` when the offset isn't a plain pixel length (percentages, `var()`, scales).
+ */
+export function parseTranslateY(transform: string | null | undefined): number | null {
+  const value = transform?.trim();
+  if (!value || value === 'none') return 0;
+
+  const match = value.match(/^(translate3d|translate|translateY|matrix|matrix3d)\((.+)\)$/);
+  if (!match) return null;
+
+  const fn = match[1] as 'translate3d' | 'translate' | 'translateY' | 'matrix' | 'matrix3d';
+  const args = match[2]!.split(',').map((arg) => arg.trim());
+  const arg = args[{ translate3d: 1, translate: 1, translateY: 0, matrix: 5, matrix3d: 13 }[fn]];
+
+  // `translate(x)` has no vertical component
+  if (arg === undefined) return fn === 'translate' ? 0 : null;
+
+  const isMatrix = fn === 'matrix' || fn === 'matrix3d';
+  const pattern = isMatrix ? /^-?[\d.]+(e[-+]?\d+)?$/ : /^-?[\d.]+(px)?$/;
+  if (!pattern.test(arg) || (!isMatrix && !arg.endsWith('px') && parseFloat(arg) !== 0)) {
+    return null;
+  }
+  return parseFloat(arg);
+}
+
+/**
+ * CSS `cubic-bezier()` timing function. Solves the curve's x for `t` with Newton's method,
+ * falling back to bisection where the slope is too flat.
+ */
+export function cubicBezier(x1: number, y1: number, x2: number, y2: number) {
+  const cx = 3 * x1;
+  const bx = 3 * (x2 - x1) - cx;
+  const ax = 1 - cx - bx;
+  const cy = 3 * y1;
+  const by = 3 * (y2 - y1) - cy;
+  const ay = 1 - cy - by;
+
+  const sampleX = (t: number) => ((ax * t + bx) * t + cx) * t;
+  const sampleY = (t: number) => ((ay * t + by) * t + cy) * t;
+  const sampleDerivativeX = (t: number) => (3 * ax * t + 2 * bx) * t + cx;
+
+  const solveX = (x: number) => {
+    let t = x;
+    for (let i = 0; i < 8; i++) {
+      const error = sampleX(t) - x;
+      if (Math.abs(error) < 1e-6) return t;
+      const slope = sampleDerivativeX(t);
+      if (Math.abs(slope) < 1e-6) break;
+      t -= error / slope;
+    }
+
+    let lower = 0;
+    let upper = 1;
+    t = x;
+    while (lower < upper) {
+      const value = sampleX(t);
+      if (Math.abs(value - x) < 1e-6) return t;
+      if (x > value) lower = t;
+      else upper = t;
+      if (upper - lower < 1e-6) break;
+      t = (lower + upper) / 2;
+    }
+    return t;
+  };
+
+  return (progress: number) => {
+    if (progress <= 0) return 0;
+    if (progress >= 1) return 1;
+    return sampleY(solveX(progress));
+  };
+}
@@ -20,6 +20,7 @@ import {
   WINDOW_TOP_OFFSET,
 } from './constants';
 import { dampenValue, getTranslate, isVertical, reset, set } from './helpers';
+import { createPositionTracker, type PositionTracker } from './position-tracker';
 import type { DrawerDirection } from './types';
 import { useComposedRefs } from './use-composed-refs';
 import { useControllableState } from './use-controllable-state';
@@ -27,6 +28,7 @@ import { usePositionFixed } from './use-position-fixed';
 import { isInput, isScrollable, usePreventScroll } from './use-prevent-scroll';
 import { useScaleBackground } from './use-scale-background';
 import { useSnapPoints } from './use-snap-points';
+import { createVelocityTracker } from './velocity-tracker';
 
 export interface WithFadeFromProps {
   /**
@@ -266,6 +268,13 @@ export function Root({
   const isAllowedToDrag = React.useRef<boolean>(false);
   const nestedOpenChangeTimer = React.useRef<NodeJS.Timeout | null>(null);
   const pointerStart = React.useRef(0);
+  const [velocityTracker] = React.useState(createVelocityTracker);
+  const pendingDrag = React.useRef<{
+    event: DragEvent;
+    pointerEvent?: React.PointerEvent<HTMLDivElement>;
+  } | null>(null);
+  const dragFrame = React.useRef<number | null>(null);
+  const positionTrackerRef = React.useRef<PositionTracker | null>(null);
   const keyboardIsOpen = React.useRef(false);
   const shouldAnimate = React.useRef(!defaultOpen);
   const previousDiffFromInitial = React.useRef(0);
@@ -388,6 +397,7 @@ export function Root({
     drawerWidthRef.current = drawerRef.current?.getBoundingClientRect().width || 0;
     setIsDragging(true);
     dragStartTime.current = new Date();
+    velocityTracker.reset();
 
     // iOS doesn't trigger mouseUp after scrolling so we need to listen to touched in order to disallow dragging
     if (isIOS()) {
@@ -491,7 +501,57 @@ export function Root({
     return true;
   }
 
+  // Pointer moves only record the latest input. Styles are written once per frame in `applyDrag`,
+  // so high polling rate pointers don't restyle the drawer several times between paints.
   function drag(event: DragEvent, pointerEvent?: React.PointerEvent<HTMLDivElement>) {
+    if (!drawerRef.current || !isDragging) {
+      return;
+    }
+
+    velocityTracker.add(
+      pointerEvent?.nativeEvent,
+      isVertical(direction) ? event.pageY : event.pageX,
+      isVertical(direction)
+    );
+    pendingDrag.current = { event, pointerEvent };
+    if (dragFrame.current === null) {
+      dragFrame.current = window.requestAnimationFrame(() => {
+        dragFrame.current = null;
+        applyDragRef.current();
+      });
+    }
+  }
+
+  function applyPendingDrag() {
+    const pending = pendingDrag.current;
+    pendingDrag.current = null;
+    if (pending) applyDrag(pending.event, pending.pointerEvent);
+    positionTrackerRef.current?.update();
+  }
+
+  // The frame callback runs after later renders, so it applies with the latest closure.
+  const applyDragRef = React.useRef(applyPendingDrag);
+  applyDragRef.current = applyPendingDrag;
+
+  React.useEffect(() => () => discardDrag(), []);
+
+  function flushDrag() {
+    if (dragFrame.current !== null) {
+      window.cancelAnimationFrame(dragFrame.current);
+      dragFrame.current = null;
+    }
+    applyPendingDrag();
+  }
+
+  function discardDrag() {
+    if (dragFrame.current !== null) {
+      window.cancelAnimationFrame(dragFrame.current);
+      dragFrame.current = null;
+    }
+    pendingDrag.current = null;
+  }
+
+  function applyDrag(event: DragEvent, pointerEvent?: React.PointerEvent<HTMLDivElement>) {
     if (!drawerRef.current) {
       return;
     }
@@ -754,6 +814,7 @@ export function Root({
   function cancelDrag() {
     if (!isDragging || !drawerRef.current) return;
 
+    discardDrag();
     drawerRef.current.classList.remove(DRAG_CLASS);
     isAllowedToDrag.current = false;
     unfreezeScrollables();
@@ -764,6 +825,8 @@ export function Root({
   function release(event: DragEvent | null, pointerEvent?: React.PointerEvent<HTMLDivElement>) {
     if (!isDragging || !drawerRef.current) return;
 
+    // The release decision reads the drawer's translate, so apply the last move first
+    flushDrag();
     drawerRef.current.classList.remove(DRAG_CLASS);
     isAllowedToDrag.current = false;
     unfreezeScrollables();
@@ -778,7 +841,10 @@ export function Root({
 
     const timeTaken = dragEndTime.current.getTime() - dragStartTime.current.getTime();
     const distMoved = pointerStart.current - (isVertical(direction) ? event.pageY : event.pageX);
-    const velocity = Math.abs(distMoved) / timeTaken;
+    // Release speed from the latest pointer samples, or the average over the drag when there
+    // are too few of them
+    const velocity =
+      velocityTracker.velocity(performance.now()) ?? Math.abs(distMoved) / timeTaken;
 
     if (velocity > 0.05) {
       // `justReleased` is needed to prevent the drawer from focusing on an input when the drag ends, as it's not the intent most of the time.
@@ -969,6 +1035,7 @@ export function Root({
           container,
           autoFocus,
           onPositionChangeRef,
+          positionTrackerRef,
           setContentHeight,
           detached,
           detachedOffset: detached ? detachedOffset : 0,
@@ -1108,6 +1175,7 @@ export const Content = React.forwardRef<HTMLDivElement, ContentProps>(
       shouldAnimate,
       autoFocus,
       onPositionChangeRef,
+      positionTrackerRef,
       setContentHeight,
       detached,
       detachedOffset,
@@ -1191,106 +1259,24 @@ export const Content = React.forwardRef<HTMLDivElement, ContentProps>(
 
     // Event-driven position tracking. We only tick RAF while the drawer is
     // actually moving (drag / CSS transition / CSS animation). When it's idle at
-    // a snap, no frames run at all.
-    const positionTrackingRef = React.useRef<{
-      rafId: number | null;
-      movingCount: number;
-      lastPosition: number;
-      start: () => void;
-      stop: () => void;
-    } | null>(null);
-
+    // a snap, no frames run at all. The tracker lives on the root so drag frames
+    // can report right after they write.
     React.useEffect(() => {
       const drawer = drawerRef.current;
       if (!drawer) return;
 
-      const state = {
-        rafId: null as number | null,
-        movingCount: 0,
-        lastPosition: Number.NaN,
-        start: () => {},
-        stop: () => {},
-      };
-
-      const emit = () => {
-        const cb = onPositionChangeRef.current;
-        if (!cb) return;
-        const position = drawer.getBoundingClientRect().top;
-        if (position !== state.lastPosition) {
-          state.lastPosition = position;
-          cb(position);
-        }
-      };
-
-      const tick = () => {
-        emit();
-        state.rafId = state.movingCount > 0 ? window.requestAnimationFrame(tick) : null;
-      };
-
-      state.start = () => {
-        state.movingCount += 1;
-        if (state.rafId === null) {
-          state.rafId = window.requestAnimationFrame(tick);
-        }
-      };
-
-      state.stop = () => {
-        state.movingCount = Math.max(0, state.movingCount - 1);
-        // RAF loop will exit on its next tick; emit the settled position now.
-        if (state.movingCount === 0) emit();
-      };
-
       const wrapper = drawer.closest<HTMLElement>('[data-vaul-detached-wrapper]');
-
-      // Listen on the wrapper too: drag-overshoot snap-back animates the wrapper
-      // alone when the drawer's target is unchanged (e.g. snapping back to the
-      // same detent). Without this, position goes stale mid-animation because
-      // the drawer's `transitionrun` never fires.
-      const onTransitionRun = (e: TransitionEvent) => {
-        if ((e.target === drawer || e.target === wrapper) && e.propertyName === 'transform')
-          state.start();
-      };
-      const onTransitionDone = (e: TransitionEvent) => {
-        if ((e.target === drawer || e.target === wrapper) && e.propertyName === 'transform')
-          state.stop();
-      };
-      const onAnimationStart = (e: AnimationEvent) => {
-        if (e.target === drawer || e.target === wrapper) state.start();
-      };
-      const onAnimationDone = (e: AnimationEvent) => {
-        if (e.target === drawer || e.target === wrapper) state.stop();
-      };
-
-      drawer.addEventListener('transitionrun', onTransitionRun);
-      drawer.addEventListener('transitionend', onTransitionDone);
-      drawer.addEventListener('transitioncancel', onTransitionDone);
-      drawer.addEventListener('animationstart', onAnimationStart);
-      drawer.addEventListener('animationend', onAnimationDone);
-      drawer.addEventListener('animationcancel', onAnimationDone);
-      wrapper?.addEventListener('transitionrun', onTransitionRun);
-      wrapper?.addEventListener('transitionend', onTransitionDone);
-      wrapper?.addEventListener('transitioncancel', onTransitionDone);
-
-      positionTrackingRef.current = state;
-      emit();
+      const tracker = createPositionTracker(drawer, wrapper, onPositionChangeRef);
+      positionTrackerRef.current = tracker;
 
       return () => {
-        drawer.removeEventListener('transitionrun', onTransitionRun);
-        drawer.removeEventListener('transitionend', onTransitionDone);
-        drawer.removeEventListener('transitioncancel', onTransitionDone);
-        drawer.removeEventListener('animationstart', onAnimationStart);
-        drawer.removeEventListener('animationend', onAnimationDone);
-        drawer.removeEventListener('animationcancel', onAnimationDone);
-        wrapper?.removeEventListener('transitionrun', onTransitionRun);
-        wrapper?.removeEventListener('transitionend', onTransitionDone);
-        wrapper?.removeEventListener('transitioncancel', onTransitionDone);
-        if (state.rafId !== null) window.cancelAnimationFrame(state.rafId);
-        positionTrackingRef.current = null;
+        tracker.dispose();
+        positionTrackerRef.current = null;
       };
     }, []);
 
     React.useEffect(() => {
-      const state = positionTrackingRef.current;
+      const state = positionTrackerRef.current;
       if (!state) return;
       if (isDragging) state.start();
       else state.stop();
@@ -0,0 +1,257 @@
+import { TRANSITIONS } from './constants';
+import { cubicBezier, parseTranslateY } from './helpers';
+
+type Easing = (progress: number) => number;
+
+interface Motion {
+  from: number;
+  to: number;
+  startTime: number;
+  duration: number;
+  easing: Easing;
+}
+
+interface Layer {
+  element: HTMLElement;
+  /** Running transition or animation of the layer's vertical translate. */
+  motion: Motion | null;
+  /** Running animations whose translate can't be modeled, so positions are measured instead. */
+  unmodeled: Set<string>;
+}
+
+export interface PositionTracker {
+  /** Marks the drawer as moving (drag, transition or animation) until the matching `stop`. */
+  start: () => void;
+  stop: () => void;
+  /** Reports the position right away, e.g. after a drag frame wrote its transforms. */
+  update: () => void;
+  dispose: () => void;
+}
+
+const defaultEasing = cubicBezier(...(TRANSITIONS.EASE as [number, number, number, number]));
+
+function parseEasing(easing: string | undefined): Easing {
+  if (easing === 'linear') return (progress) => progress;
+
+  const match = easing?.match(/^cubic-bezier\((.+)\)$/);
+  const points = match?.[1]!.split(',').map(parseFloat);
+  if (points?.length === 4 && points.every((point) => !Number.isNaN(point))) {
+    return cubicBezier(points[0]!, points[1]!, points[2]!, points[3]!);
+  }
+  return defaultEasing;
+}
+
+/**
+ * Builds a motion from the animation's keyframes, or returns `null` when its translate isn't
+ * in pixels. Animations without a transform keyframe don't move the layer and return `undefined`.
+ */
+function motionFromAnimation(
+  animation: Animation | undefined,
+  now: number
+): Motion | null | undefined {
+  const effect = animation?.effect as KeyframeEffect | null | undefined;
+  if (!effect?.getKeyframes) return null;
+
+  const keyframes = effect.getKeyframes().filter((keyframe) => keyframe.transform !== undefined);
+  if (keyframes.length === 0) return undefined;
+
+  const from = parseTranslateY(keyframes[0]!.transform as string);
+  const to = parseTranslateY(keyframes[keyframes.length - 1]!.transform as string);
+  if (from === null || to === null) return null;
+
+  const timing = effect.getComputedTiming();
+  const duration =
+    typeof timing.duration === 'number' ? timing.duration : TRANSITIONS.DURATION * 1000;
+
+  return {
+    from,
+    to,
+    startTime: now + (timing.delay ?? 0),
+    duration,
+    easing: parseEasing(timing.easing),
+  };
+}
+
+/**
+ * Reports the drawer's top edge while it moves without reading layout every frame.
+ *
+ * The drawer's position is its untransformed top plus the vertical translates of the drawer and
+ * the detached wrapper. Drag frames write those translates inline, and transitions and animations
+ * run from a keyframe to a target along a known easing curve, so each frame's position is
+ * computed from that model. Layout is read once when a session or motion starts, to anchor the
+ * model, and once when the drawer settles, so the reported rest position is always exact.
+ * Motions that can't be modeled (percentage or `var()` keyframes) are measured every frame.
+ */
+export function createPositionTracker(
+  drawer: HTMLElement,
+  wrapper: HTMLElement | null,
+  listener: { readonly current: ((position: number) => void) | null | undefined }
+): PositionTracker {
+  const layers: Layer[] = [drawer, wrapper]
+    .filter((element): element is HTMLElement => !!element)
+    .map((element) => ({ element, motion: null, unmodeled: new Set() }));
+
+  let rafId: number | null = null;
+  let movingCount = 0;
+  let lastPosition = Number.NaN;
+  /** Untransformed top of the drawer, or `null` until the next layout read. */
+  let base: number | null = null;
+
+  const layerFor = (target: EventTarget | null) => layers.find((layer) => layer.element === target);
+
+  const emit = (position: number) => {
+    if (position !== lastPosition) {
+      lastPosition = position;
+      listener.current?.(position);
+    }
+  };
+
+  const measure = () => drawer.getBoundingClientRect().top;
+
+  /** Sum of the modeled translates, or `null` when any layer can't be modeled. */
+  const modeledTranslate = (now: number) => {
+    let total = 0;
+    for (const layer of layers) {
+      if (layer.unmodeled.size > 0) return null;
+
+      const { motion } = layer;
+      if (motion) {
+        const elapsed = now - motion.startTime;
+        const progress =
+          motion.duration > 0 ? Math.min(1, Math.max(0, elapsed / motion.duration)) : 1;
+        total += motion.from + (motion.to - motion.from) * motion.easing(progress);
+        continue;
+      }
+
+      const translate = parseTranslateY(layer.element.style.transform);
+      if (translate === null) return null;
+      total += translate;
+    }
+    return total;
+  };
+
+  const update = () => {
+    if (movingCount === 0 || !listener.current) return;
+
+    const translate = modeledTranslate(performance.now());
+    if (translate === null) {
+      base = null;
+      emit(measure());
+      return;
+    }
+
+    if (base === null) {
+      const position = measure();
+      base = position - translate;
+      emit(position);
+      return;
+    }
+
+    emit(base + translate);
+  };
+
+  const tick = () => {
+    rafId = movingCount > 0 ? requestAnimationFrame(tick) : null;
+    update();
+  };
+
+  const start = () => {
+    if (movingCount === 0) base = null;
+    movingCount += 1;
+    if (rafId === null) {
+      rafId = requestAnimationFrame(tick);
+    }
+  };
+
+  const stop = () => {
+    movingCount = Math.max(0, movingCount - 1);
+    if (movingCount > 0) return;
+
+    // RAF loop will exit on its next tick; emit the settled position now.
+    for (const layer of layers) {
+      layer.motion = null;
+      layer.unmodeled.clear();
+    }
+    base = null;
+    if (listener.current) emit(measure());
+  };
+
+  const beginMotion = (layer: Layer, motion: Motion | null | undefined, key: string) => {
+    if (motion === undefined) return;
+
+    layer.motion = motion;
+    if (motion === null) layer.unmodeled.add(key);
+
+    // Re-anchor on the next frame, the starting keyframe may differ from the believed translate.
+    base = null;
+  };
+
+  // Listen on the wrapper too: drag-overshoot snap-back animates the wrapper
+  // alone when the drawer's target is unchanged (e.g. snapping back to the
+  // same detent). Without this, position goes stale mid-animation because
+  // the drawer's `transitionrun` never fires.
+  const onTransitionRun = (e: TransitionEvent) => {
+    const layer = layerFor(e.target);
+    if (!layer || e.propertyName !== 'transform') return;
+
+    const transition = layer.element
+      .getAnimations()
+      .find((animation) => (animation as CSSTransition).transitionProperty === 'transform');
+    beginMotion(layer, motionFromAnimation(transition, performance.now()), 'transition');
+    start();
+  };
+  const onTransitionDone = (e: TransitionEvent) => {
+    const layer = layerFor(e.target);
+    if (!layer || e.propertyName !== 'transform') return;
+
+    layer.motion = null;
+    layer.unmodeled.delete('transition');
+    stop();
+  };
+  const onAnimationStart = (e: AnimationEvent) => {
+    const layer = layerFor(e.target);
+    if (!layer) return;
+
+    const animation = layer.element
+      .getAnimations()
+      .find((running) => (running as CSSAnimation).animationName === e.animationName);
+    beginMotion(layer, motionFromAnimation(animation, performance.now()), e.animationName);
+    start();
+  };
+  const onAnimationDone = (e: AnimationEvent) => {
+    const layer = layerFor(e.target);
+    if (!layer) return;
+
+    layer.motion = null;
+    layer.unmodeled.delete(e.animationName);
+    stop();
+  };
+
+  for (const { element } of layers) {
+    element.addEventListener('transitionrun', onTransitionRun);
+    element.addEventListener('transitionend', onTransitionDone);
+    element.addEventListener('transitioncancel', onTransitionDone);
+  }
+  drawer.addEventListener('animationstart', onAnimationStart);
+  drawer.addEventListener('animationend', onAnimationDone);
+  drawer.addEventListener('animationcancel', onAnimationDone);
+
+  if (listener.current) emit(measure());
+
+  return {
+    start,
+    stop,
+    update,
+    dispose: () => {
+      for (const { element } of layers) {
+        element.removeEventListener('transitionrun', onTransitionRun);
+        element.removeEventListener('transitionend', onTransitionDone);
+        element.removeEventListener('transitioncancel', onTransitionDone);
+      }
+      drawer.removeEventListener('animationstart', onAnimationStart);
+      drawer.removeEventListener('animationend', onAnimationDone);
+      drawer.removeEventListener('animationcancel', onAnimationDone);
+      if (rafId !== null) cancelAnimationFrame(rafId);
+    },
+  };
+}
@@ -0,0 +1,64 @@
+/** Only samples this recent count toward the release velocity. */
+const VELOCITY_WINDOW = 100;
+const MAX_SAMPLES = 32;
+
+interface Sample {
+  time: number;
+  position: number;
+}
+
+export interface VelocityTracker {
+  reset: () => void;
+  /**
+   * Records the pointer positions of a move, including the ones the browser coalesced into it
+   * (`getCoalescedEvents()`), so high polling rate input isn't reduced to one sample per frame.
+   */
+  add: (event: PointerEvent | null | undefined, position: number, vertical: boolean) => void;
+  /**
+   * Speed in px/ms over the most recent samples, `0` when the pointer has paused, or `null`
+   * when there aren't enough samples to tell.
+   */
+  velocity: (now: number) => number | null;
+}
+
+export function createVelocityTracker(): VelocityTracker {
+  const samples: Sample[] = [];
+
+  const push = (time: number, position: number) => {
+    const last = samples[samples.length - 1];
+    // Coalesced events of consecutive moves can overlap
+    if (last && time <= last.time) return;
+
+    samples.push({ time, position });
+    if (samples.length > MAX_SAMPLES) samples.shift();
+  };
+
+  return {
+    reset: () => {
+      samples.length = 0;
+    },
+    add: (event, position, vertical) => {
+      const coalesced = event?.getCoalescedEvents?.() ?? [];
+      for (const sample of coalesced) {
+        push(sample.timeStamp, vertical ? sample.pageY : sample.pageX);
+      }
+      if (coalesced.length === 0) {
+        push(event?.timeStamp ?? performance.now(), position);
+      }
+    },
+    velocity: (now) => {
+      if (samples.length < 2) return null;
+
+      const last = samples[samples.length - 1]!;
+      if (now - last.time > VELOCITY_WINDOW) return 0;
+
+      // Oldest sample in the window, or the one before the last if it's alone in there
+      let start = samples.length - 2;
+      while (start > 0 && now - samples[start - 1]!.time <= VELOCITY_WINDOW) start--;
+      const first = samples[start]!;
+
+      const elapsed = last.time - first.time;
+      return elapsed > 0 ? Math.abs(last.position - first.position) / elapsed : null;
+    },
+  };
+}